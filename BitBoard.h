@@ -0,0 +1,183 @@
+// BitBoard.h
+// Bitboard backend for two-player mark games (X-O variants, Memory, obstacles)
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include "BoardGame_Classes.h"
+#include <cstdint>
+#include <cctype>
+
+/**
+ * @brief One 64-bit word per side plus an obstacle mask.
+ *
+ * Cell (x, y) maps to bit x * stride + y, where stride = columns + 1.
+ * The extra column is never set, so a run of shifted bits can never wrap
+ * from the end of one row into the start of the next. Every board with
+ * rows * (columns + 1) <= 64 fits (up to 7x7).
+ */
+class BitBoard {
+    uint64_t marks[2] = { 0, 0 }; ///< Cells held by 'X' (0) and 'O' (1)
+    uint64_t obstacles = 0;       ///< Cells nobody can use
+    int stride;                   ///< Bits per row, including the guard column
+
+    /**
+     * @brief Keep only the cells that start a run of k set bits.
+     * @param b Bitboard to scan
+     * @param shift Distance between consecutive cells of the run
+     * @param k Run length
+     */
+    static uint64_t runs(uint64_t b, int shift, int k) {
+        uint64_t m = b;
+        for (int i = 1; i < k; ++i)
+            m &= b >> (i * shift);
+        return m;
+    }
+
+public:
+    /**
+     * @brief Construct an empty bitboard for a grid with the given width.
+     */
+    explicit BitBoard(int columns) : stride(columns + 1) {}
+
+    /** @brief Map a mark to its side index ('X' -> 0, 'O' -> 1). */
+    static int side_of(char symbol) { return toupper(symbol) == 'O' ? 1 : 0; }
+
+    /** @brief Single-bit mask of cell (x, y). */
+    uint64_t bit(int x, int y) const { return uint64_t(1) << (x * stride + y); }
+
+    /** @brief Put a mark on cell (x, y). */
+    void set_mark(int x, int y, char symbol) { marks[side_of(symbol)] |= bit(x, y); }
+
+    /** @brief Put an obstacle on cell (x, y). */
+    void set_obstacle(int x, int y) { obstacles |= bit(x, y); }
+
+    /** @brief Remove whatever occupies cell (x, y). */
+    void clear(int x, int y) {
+        uint64_t keep = ~bit(x, y);
+        marks[0] &= keep;
+        marks[1] &= keep;
+        obstacles &= keep;
+    }
+
+    /** @brief Cells held by the side using symbol. */
+    uint64_t get_marks(char symbol) const { return marks[side_of(symbol)]; }
+
+    /** @brief Obstacle cells. */
+    uint64_t get_obstacles() const { return obstacles; }
+
+    /** @brief Every non-empty cell. */
+    uint64_t occupied() const { return marks[0] | marks[1] | obstacles; }
+
+    /** @brief Bits per row, including the guard column. */
+    int get_stride() const { return stride; }
+
+    /**
+     * @brief Check if symbol has k in a row in any direction.
+     */
+    bool has_line(char symbol, int k) const {
+        uint64_t b = get_marks(symbol);
+        return runs(b, 1, k) || runs(b, stride, k) ||
+               runs(b, stride + 1, k) || runs(b, stride - 1, k);
+    }
+
+    /**
+     * @brief Check if symbol has k in a row through cell (x, y).
+     *
+     * Walks out from the cell in both senses of each direction, so it costs
+     * O(k) instead of a whole-board scan. The guard column stops row wraps.
+     */
+    bool has_line_through(char symbol, int x, int y, int k) const {
+        uint64_t b = get_marks(symbol);
+        int index = x * stride + y;
+        const int shifts[4] = { 1, stride, stride + 1, stride - 1 };
+        for (int shift : shifts) {
+            int count = 1;
+            for (int i = index + shift; i < 64 && (b >> i & 1); i += shift) count++;
+            for (int i = index - shift; i >= 0 && (b >> i & 1); i -= shift) count++;
+            if (count >= k) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Count every k-cell window fully held by symbol.
+     *
+     * Overlapping windows are counted separately, so four in a row holds
+     * two lines of three.
+     */
+    int count_lines(char symbol, int k) const {
+        uint64_t b = get_marks(symbol);
+        return __builtin_popcountll(runs(b, 1, k)) +
+               __builtin_popcountll(runs(b, stride, k)) +
+               __builtin_popcountll(runs(b, stride + 1, k)) +
+               __builtin_popcountll(runs(b, stride - 1, k));
+    }
+};
+
+/**
+ * @brief Board<char> whose X, O and obstacle cells are mirrored in a BitBoard.
+ *
+ * Derived boards keep their usual char cells for display and get_cell(),
+ * but must write cells through set_cell() so the bitboard stays in sync.
+ * Win tests then become a handful of shift-and-AND operations.
+ */
+class BitBoard_Board : public Board<char> {
+protected:
+    BitBoard bits; ///< Bitboard mirror of the cells
+
+    /**
+     * @brief Write a cell and keep the bitboard in sync.
+     *
+     * 'X' and 'O' (any case) become marks, '#' becomes an obstacle and
+     * anything else is treated as empty. Undo goes through here too, so the
+     * bitboard follows unmake_move() for free.
+     */
+    void set_cell(int x, int y, const char& value) override {
+        Board<char>::set_cell(x, y, value);
+        bits.clear(x, y);
+        char c = toupper(value);
+        if (c == 'X' || c == 'O') bits.set_mark(x, y, c);
+        else if (c == '#') bits.set_obstacle(x, y);
+    }
+
+    /** @brief Check if symbol has k in a row anywhere on the board. */
+    bool has_line(char symbol, int k) const { return bits.has_line(symbol, k); }
+
+    /** @brief Check if symbol has k in a row through cell (x, y). */
+    bool has_line_through(char symbol, int x, int y, int k) const {
+        return bits.has_line_through(symbol, x, y, k);
+    }
+
+    /**
+     * @brief Append a move with symbol for every empty cell.
+     *
+     * Walks the set bits of the free-cell mask instead of scanning chars.
+     */
+    void add_empty_cells(char symbol, MoveList<char>& moves) const {
+        int stride = bits.get_stride();
+        uint64_t row_mask = (uint64_t(1) << columns) - 1;
+        uint64_t free_cells = 0;
+        for (int x = 0; x < rows; ++x)
+            free_cells |= row_mask << (x * stride);
+        free_cells &= ~bits.occupied();
+
+        while (free_cells) {
+            int index = __builtin_ctzll(free_cells);
+            free_cells &= free_cells - 1;
+            moves.push_back(Move<char>(index / stride, index % stride, symbol));
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a board with given dimensions and an empty bitboard.
+     */
+    BitBoard_Board(int rows, int columns)
+        : Board<char>(rows, columns), bits(columns) {}
+
+    /** @brief Read-only access to the bitboard state. */
+    const BitBoard& get_bitboard() const { return bits; }
+};
+
+#endif // BITBOARD_H
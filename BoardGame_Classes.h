@@ -11,6 +11,10 @@
 #include <vector>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <array>
 using namespace std;
 
 /////////////////////////////////////////////////////////////
@@ -19,6 +23,7 @@ using namespace std;
 
 template <typename T> class Player;
 template <typename T> class Move;
+template <typename T> class MoveList;
 
 /////////////////////////////////////////////////////////////
 // Class declarations
@@ -34,6 +39,108 @@ enum class PlayerType {
     RANDOM     ///< A Random player.
 };
 
+/**
+ * @brief State of the game as seen by the player who just moved.
+ */
+enum class GameOutcome {
+    WIN,     ///< The mover has won.
+    LOSS,    ///< The mover has lost.
+    DRAW,    ///< The game ended without a winner.
+    ONGOING  ///< The game goes on.
+};
+
+/**
+ * @brief Contiguous row-major storage for the cells of a board.
+ *
+ * @tparam T Type of the elements stored on the board.
+ *
+ * All cells live in one buffer with a fixed stride of `columns`, so
+ * `grid[x][y]` is a single multiply-add instead of a per-row pointer chase.
+ * The buffer is either owned by the grid or supplied by the board
+ * (see FixedBoard), so the grid is not copyable.
+ */
+template <typename T>
+class BoardGrid {
+    vector<T> owned; ///< Cell buffer when the grid owns its storage
+    T* cells;        ///< First cell of the row-major buffer
+    int count;       ///< Number of cells
+    int stride;      ///< Number of cells per row
+
+public:
+    /** @brief Construct a grid of rows x columns default-valued cells. */
+    BoardGrid(int rows, int columns)
+        : owned(rows * columns), cells(owned.data()),
+          count(rows * columns), stride(columns) {}
+
+    /** @brief Construct a grid over rows x columns cells owned by the caller. */
+    BoardGrid(T* storage, int rows, int columns)
+        : cells(storage), count(rows * columns), stride(columns) {}
+
+    BoardGrid(const BoardGrid&) = delete;
+    BoardGrid& operator=(const BoardGrid&) = delete;
+
+    /** @brief Return a pointer to the first cell of a row. */
+    T* operator[](int row) { return cells + row * stride; }
+
+    /** @brief Return a read-only pointer to the first cell of a row. */
+    const T* operator[](int row) const { return cells + row * stride; }
+
+    /** @brief Set every cell to the same value. */
+    void fill(const T& value) { std::fill(cells, cells + count, value); }
+
+    /** @brief Raw access to the underlying buffer. */
+    T* data() { return cells; }
+    const T* data() const { return cells; }
+
+    /** @brief Total number of cells. */
+    int size() const { return count; }
+
+    /** @brief Number of cells per row. */
+    int get_stride() const { return stride; }
+
+    /** @brief Iterate over every cell in row-major order. */
+    T* begin() { return cells; }
+    T* end() { return cells + count; }
+    const T* begin() const { return cells; }
+    const T* end() const { return cells + count; }
+};
+
+/**
+ * @brief Non-owning, read-only view of a board's cells.
+ *
+ * @tparam T Type of the elements stored on the board.
+ *
+ * A view is just a pointer plus dimensions, so it is cheap to pass by value
+ * and never allocates. It stays valid as long as the board it came from.
+ */
+template <typename T>
+class BoardView {
+    const T* cells; ///< First cell of the viewed board
+    int rows;       ///< Number of rows
+    int columns;    ///< Number of columns
+    int stride;     ///< Distance between the starts of two rows
+
+public:
+    /** @brief Construct a view over a row-major buffer. */
+    BoardView(const T* cells, int rows, int columns, int stride)
+        : cells(cells), rows(rows), columns(columns), stride(stride) {}
+
+    /** @brief Return content of cell x, y. */
+    const T& operator()(int x, int y) const { return cells[x * stride + y]; }
+
+    /** @brief Return a pointer to the first cell of a row, so view[x][y] works. */
+    const T* operator[](int row) const { return cells + row * stride; }
+
+    /** @brief Get number of rows. */
+    int get_rows() const { return rows; }
+
+    /** @brief Get number of columns. */
+    int get_columns() const { return columns; }
+
+    /** @brief Check whether the view has no cells. */
+    bool empty() const { return rows == 0 || columns == 0; }
+};
+
 /**
  * @brief Base template for any board used in board games.
  *
@@ -44,18 +151,113 @@ enum class PlayerType {
  */
 template <typename T>
 class Board {
+    /**
+     * @brief One cell write recorded while make_move() is running.
+     */
+    struct CellChange {
+        int x;       ///< Row index
+        int y;       ///< Column index
+        T old_value; ///< Content before the write
+    };
+
+    /**
+     * @brief Where a move's cell writes start in the journal, and n_moves before it.
+     */
+    struct HistoryEntry {
+        int journal_size; ///< Journal size before the move
+        int n_moves;      ///< Move counter before the move
+    };
+
+    vector<CellChange> journal;   ///< Cell writes of every move on the history stack
+    vector<HistoryEntry> history; ///< One entry per move made with make_move()
+    bool recording = false;       ///< True while make_move() is applying a move
+
 protected:
     int rows;        ///< Number of rows
     int columns;     ///< Number of columns
-    vector<vector<T>> board; ///< 2D vector for the board
+    BoardGrid<T> board; ///< Contiguous row-major cell storage
     int n_moves = 0; ///< Number of moves made
+    bool quiet = false; ///< Suppress console messages (headless play)
+    uint64_t hash = 0; ///< Zobrist key of the cells, kept in sync by set_cell()
+
+    /**
+     * @brief Scramble a 64-bit value (splitmix64 finalizer).
+     */
+    static uint64_t mix_key(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Zobrist key of value sitting in the cell with the given index.
+     *
+     * Computed on the fly instead of read from a random table, so it works
+     * for any cell type with a std::hash and any board size.
+     */
+    static uint64_t zobrist_key(int index, const T& value) {
+        return mix_key(uint64_t(std::hash<T>()(value)) +
+                       0x9E3779B97F4A7C15ULL * uint64_t(index + 1));
+    }
+
+    /**
+     * @brief Write a cell, journaling the old content while a move is being made.
+     *
+     * Every cell change a move causes (placements, removals, obstacles, ...)
+     * must go through here so unmake_move() can roll it back and the
+     * Zobrist key stays current.
+     */
+    virtual void set_cell(int x, int y, const T& value) {
+        if (recording) journal.push_back({ x, y, board[x][y] });
+        int index = x * columns + y;
+        hash ^= zobrist_key(index, board[x][y]) ^ zobrist_key(index, value);
+        board[x][y] = value;
+    }
+
+    /**
+     * @brief Set every cell to value (constructors) and recompute the key.
+     */
+    void fill_cells(const T& value) {
+        board.fill(value);
+        hash = 0;
+        for (int i = 0; i < rows * columns; ++i)
+            hash ^= zobrist_key(i, value);
+    }
+
+    /**
+     * @brief Save game-specific state (scores, queues, counters) before a move.
+     *
+     * Called by make_move() just before update_board(). Boards whose state is
+     * only cells and n_moves don't need to override it.
+     */
+    virtual void save_state() {}
+
+    /**
+     * @brief Restore the state saved by the matching save_state() call.
+     * @param applied false if the move was rejected and nothing changed, so
+     *        the saved state only needs to be dropped.
+     */
+    virtual void restore_state(bool /*applied*/) {}
 
 public:
     /**
      * @brief Construct a board with given dimensions.
      */
     Board(int rows, int columns)
-        : rows(rows), columns(columns), board(rows, vector<T>(columns)) {}
+        : rows(rows), columns(columns), board(rows, columns) {
+        fill_cells(T());
+    }
+
+    /**
+     * @brief Construct a board over rows x columns cells owned by a derived class.
+     *
+     * The storage must outlive the board; FixedBoard keeps it in a base
+     * class constructed before Board<T>.
+     */
+    Board(int rows, int columns, T* storage)
+        : rows(rows), columns(columns), board(storage, rows, columns) {
+        fill_cells(T());
+    }
 
     /**
      * @brief Virtual destructor. Frees allocated board memory.
@@ -67,7 +269,7 @@ public:
      * @param move The move object containing position and symbol.
      * @return true if the move is valid and applied, false otherwise.
      */
-    virtual bool update_board(Move<T>* move) = 0;
+    virtual bool update_board(const Move<T>& move) = 0;
 
     /** @brief Check if a player has won. */
     virtual bool is_win(Player<T>*) = 0;
@@ -81,11 +283,100 @@ public:
     /** @brief Check if the game is over. */
     virtual bool game_is_over(Player<T>*) = 0;
 
+    /**
+     * @brief List every legal move for a player in the current position.
+     *
+     * Fills a caller-owned fixed-capacity buffer, so move generation never
+     * touches the heap. Moves use the same encoding update_board() expects.
+     * @param player The player to move.
+     * @param moves Cleared, then filled with the legal moves.
+     */
+    virtual void generate_moves(Player<T>* player, MoveList<T>& moves) = 0;
+
+    /**
+     * @brief Decide the game right after last_move was applied.
+     *
+     * Boards override this to look only at the lines through the cell the
+     * move touched. The default falls back to is_win(), is_lose() and
+     * is_draw() for a player holding the move's symbol.
+     * @param last_move The move that was just applied.
+     * @return The outcome for the player who made last_move.
+     */
+    virtual GameOutcome outcome_after(const Move<T>& last_move) {
+        Player<T> mover("", last_move.get_symbol(), PlayerType::HUMAN);
+        mover.set_board_ptr(this);
+
+        if (is_win(&mover)) return GameOutcome::WIN;
+        if (is_lose(&mover)) return GameOutcome::LOSS;
+        if (is_draw(&mover)) return GameOutcome::DRAW;
+        return GameOutcome::ONGOING;
+    }
+
+    /**
+     * @brief Apply a move and push it on the undo stack.
+     * @param move The move object containing position and symbol.
+     * @return true if the move is valid and applied, false otherwise.
+     */
+    bool make_move(const Move<T>& move) {
+        history.push_back({ (int)journal.size(), n_moves });
+        save_state();
+
+        recording = true;
+        bool applied = update_board(move);
+        recording = false;
+
+        if (!applied) rollback(false);
+        return applied;
+    }
+
+    /**
+     * @brief Take back the last move applied with make_move().
+     *
+     * Restores every cell the move touched, n_moves and any game-specific
+     * state, in time proportional to the cells the move changed.
+     * @return false if there is no move to take back.
+     */
+    bool unmake_move() {
+        if (history.empty()) return false;
+        rollback(true);
+        return true;
+    }
+
+    /** @brief Number of moves that unmake_move() can take back. */
+    int get_history_size() const { return (int)history.size(); }
+
+    /**
+     * @brief 64-bit Zobrist key of the current position.
+     *
+     * XOR of one key per (cell, content) pair, updated on every placement,
+     * removal and undo, so equal cells always give equal keys.
+     */
+    virtual uint64_t get_hash() const { return hash; }
+
+    /** @brief Silence (or restore) the board's own console messages. */
+    void set_quiet(bool value) { quiet = value; }
+
+    /** @brief Check if the board's console messages are silenced. */
+    bool is_quiet() const { return quiet; }
+
+    /**
+     * @brief Return a read-only view of the current board without copying.
+     */
+    BoardView<T> get_board_view() const {
+        return BoardView<T>(board.data(), rows, columns, board.get_stride());
+    }
+
     /**
      * @brief Return a copy of the current board as a 2D vector.
+     *
+     * Only use this when the caller needs its own scratch matrix;
+     * get_board_view() covers read-only access.
      */
     vector<vector<T>> get_board_matrix() const {
-        return board;
+        vector<vector<T>> matrix(rows);
+        for (int i = 0; i < rows; ++i)
+            matrix[i].assign(board[i], board[i] + columns);
+        return matrix;
     }
 
     /** @brief Get number of rows. */
@@ -96,9 +387,68 @@ public:
 
     /** @brief Return content of cell x, y in current board. */
 
-    T get_cell(int x, int y) {
+    T get_cell(int x, int y) const {
         return board[x][y];
     }
+
+private:
+    /**
+     * @brief Pop the top history entry and undo its cell writes and state.
+     * @param applied false when dropping the entry of a rejected move.
+     */
+    void rollback(bool applied) {
+        HistoryEntry entry = history.back();
+        history.pop_back();
+
+        while ((int)journal.size() > entry.journal_size) {
+            CellChange change = journal.back();
+            journal.pop_back();
+            set_cell(change.x, change.y, change.old_value);
+        }
+        n_moves = entry.n_moves;
+        restore_state(applied);
+    }
+};
+
+//-----------------------------------------------------
+/**
+ * @brief Cell array of a FixedBoard.
+ *
+ * Kept in its own base class so it is constructed before the Board<T>
+ * that points at it.
+ */
+template <typename T, int R, int C>
+struct FixedBoardStorage {
+    array<T, R * C> cells{}; ///< Row-major cells
+};
+
+/**
+ * @brief Board<T> whose dimensions are compile-time constants.
+ *
+ * @tparam T Type of the elements stored on the board.
+ * @tparam R Number of rows.
+ * @tparam C Number of columns.
+ *
+ * The cells live in a std::array inside the board and at() uses constexpr
+ * index math, so win checks bounded by ROWS and COLUMNS can be fully
+ * unrolled. Writes still go through set_cell(), so undo and hashing work
+ * as usual. Use the plain Board<T> for boards sized at runtime.
+ */
+template <typename T, int R, int C>
+class FixedBoard : private FixedBoardStorage<T, R, C>, public Board<T> {
+public:
+    static constexpr int ROWS = R;    ///< Number of rows
+    static constexpr int COLUMNS = C; ///< Number of columns
+
+    /** @brief Row-major index of cell (x, y). */
+    static constexpr int index(int x, int y) { return x * C + y; }
+
+    /** @brief Construct a board of default-valued cells. */
+    FixedBoard() : FixedBoardStorage<T, R, C>(), Board<T>(R, C, this->cells.data()) {}
+
+protected:
+    /** @brief Read cell (x, y) at a compile-time offset. */
+    const T& at(int x, int y) const { return this->cells[index(x, y)]; }
 };
 
 //-----------------------------------------------------
@@ -114,6 +464,9 @@ class Move {
     T symbol;   ///< Symbol used in the move
 
 public:
+    /** @brief Construct an off-board move that every board rejects. */
+    Move() : x(-1), y(-1), symbol() {}
+
     /** @brief Construct a move at (x, y) using a symbol. */
     Move(int x, int y, T symbol) : x(x), y(y), symbol(symbol) {}
 
@@ -127,6 +480,46 @@ public:
     T get_symbol() const { return symbol; }
 };
 
+//-----------------------------------------------------
+/**
+ * @brief Fixed-capacity list of moves filled by Board::generate_moves().
+ *
+ * @tparam T Type of symbol placed on the board.
+ *
+ * Storage is a std::array inside the list, so a search can keep one list
+ * per ply on the stack and never allocate. CAPACITY covers the largest
+ * variant (Word: 9 cells x 26 letters).
+ */
+template <typename T>
+class MoveList {
+public:
+    static constexpr int CAPACITY = 256; ///< Maximum number of moves
+
+private:
+    array<Move<T>, CAPACITY> moves; ///< Move storage
+    int count = 0;                  ///< Number of moves in use
+
+public:
+    /** @brief Remove every move. */
+    void clear() { count = 0; }
+
+    /** @brief Append a move. */
+    void push_back(const Move<T>& move) { moves[count++] = move; }
+
+    /** @brief Number of moves in the list. */
+    int size() const { return count; }
+
+    /** @brief Check if the list holds no moves. */
+    bool empty() const { return count == 0; }
+
+    /** @brief Access the i-th move. */
+    const Move<T>& operator[](int i) const { return moves[i]; }
+
+    /** @brief Iterate over the moves in order. */
+    const Move<T>* begin() const { return moves.data(); }
+    const Move<T>* end() const { return moves.data() + count; }
+};
+
 //-----------------------------------------------------
 /**
  * @brief Base template for all players (human or AI).
@@ -220,8 +613,10 @@ public:
 
     /**
      * @brief Ask the user (or AI) to make a move.
+     *
+     * The move is returned by value, so a turn never touches the heap.
      */
-    virtual Move<T>* get_move(Player<T>*) = 0;
+    virtual Move<T> get_move(Player<T>*) = 0;
 
     /**
      * @brief Set up players for the game.
@@ -237,11 +632,11 @@ public:
      * @brief Display the current board matrix in formatted form.
      */
 
-    virtual void display_board_matrix(const vector<vector<T>>& matrix) const {
-        if (matrix.empty() || matrix[0].empty()) return;
+    virtual void display_board_matrix(const BoardView<T>& matrix) const {
+        if (matrix.empty()) return;
 
-        int rows = matrix.size();
-        int cols = matrix[0].size();
+        int rows = matrix.get_rows();
+        int cols = matrix.get_columns();
 
         cout << "\n    ";
         for (int j = 0; j < cols; ++j)
@@ -258,6 +653,27 @@ public:
     }
 };
 
+//-----------------------------------------------------
+/**
+ * @brief Outcome of a game played with GameManager::run_headless().
+ *
+ * @tparam T Type of symbol used on the board.
+ */
+template <typename T>
+struct GameResult {
+    int winner = -1;       ///< Index of the winning player (0 or 1), -1 for a draw
+    int n_moves = 0;       ///< Number of moves played
+    vector<Move<T>> moves; ///< Every accepted move, in order
+};
+
+/**
+ * @brief Picks a move for a player without any console I/O.
+ *
+ * Called again with the same arguments if the board rejects the move.
+ */
+template <typename T>
+using MovePolicy = function<Move<T>(Board<T>*, Player<T>*)>;
+
 //-----------------------------------------------------
 /**
  * @brief Controls the flow of a board game between two players.
@@ -273,6 +689,8 @@ class GameManager {
 public:
     /**
      * @brief Construct a game manager with board, players, and UI.
+     *
+     * The UI may be nullptr if the manager only calls run_headless().
      */
     GameManager(Board<T>* b, Player<T>* p[2], UI<T>* u)
         : boardPtr(b), ui(u) {
@@ -286,34 +704,85 @@ public:
      * @brief Run the main game loop until someone wins or the game ends.
      */
     void run() {
-        ui->display_board_matrix(boardPtr->get_board_matrix());
+        ui->display_board_matrix(boardPtr->get_board_view());
         Player<T>* currentPlayer = players[0];
 
         while (true) {
             for (int i : {0, 1}) {
                 currentPlayer = players[i];
-                Move<T>* move = ui->get_move(currentPlayer);
+                Move<T> move = ui->get_move(currentPlayer);
 
                 while (!boardPtr->update_board(move))
                     move = ui->get_move(currentPlayer);
 
-                ui->display_board_matrix(boardPtr->get_board_matrix());
+                ui->display_board_matrix(boardPtr->get_board_view());
 
-                if (boardPtr->is_win(currentPlayer)) {
+                GameOutcome outcome = boardPtr->outcome_after(move);
+                if (outcome == GameOutcome::WIN) {
                     ui->display_message(currentPlayer->get_name() + " wins!");
                     return;
                 }
-                if (boardPtr->is_lose(currentPlayer)) {
+                if (outcome == GameOutcome::LOSS) {
                     ui->display_message(players[1 - i]->get_name() + " wins!");
                     return;
                 }
-                if (boardPtr->is_draw(currentPlayer)) {
+                if (outcome == GameOutcome::DRAW) {
                     ui->display_message("Draw!");
                     return;
                 }
             }
         }
     }
+
+    /**
+     * @brief Play one game between two policies with no console I/O.
+     *
+     * Same turn order and end checks as run(), but moves come from the
+     * policies and go through make_move(). Once the game ends the board is
+     * rewound to where it started, so one manager can play any number of
+     * games back to back. The result's move list is reused, so after the
+     * first game no allocations are needed.
+     *
+     * @param policy0 Move source for players[0]
+     * @param policy1 Move source for players[1]
+     * @param result Filled with the winner, move count and move list
+     */
+    void run_headless(const MovePolicy<T>& policy0, const MovePolicy<T>& policy1,
+                      GameResult<T>& result) {
+        const MovePolicy<T>* policies[2] = { &policy0, &policy1 };
+        int start = boardPtr->get_history_size();
+        bool was_quiet = boardPtr->is_quiet();
+        boardPtr->set_quiet(true);
+
+        result.winner = -1;
+        result.moves.clear();
+
+        for (int i = 0; ; i = 1 - i) {
+            Player<T>* currentPlayer = players[i];
+            Move<T> move = (*policies[i])(boardPtr, currentPlayer);
+
+            while (!boardPtr->make_move(move))
+                move = (*policies[i])(boardPtr, currentPlayer);
+            result.moves.push_back(move);
+
+            GameOutcome outcome = boardPtr->outcome_after(move);
+            if (outcome == GameOutcome::WIN) {
+                result.winner = i;
+                break;
+            }
+            if (outcome == GameOutcome::LOSS) {
+                result.winner = 1 - i;
+                break;
+            }
+            if (outcome == GameOutcome::DRAW)
+                break;
+        }
+        result.n_moves = (int)result.moves.size();
+
+        while (boardPtr->get_history_size() > start)
+            boardPtr->unmake_move();
+        boardPtr->set_quiet(was_quiet);
+    }
 };
 
 //-----------------------------------------------------
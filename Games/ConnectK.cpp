@@ -0,0 +1,172 @@
+#include "ConnectK.h"
+#include "ConnectK_AI_Player.h"
+#include <iostream>
+#include <cstdlib>
+
+using namespace std;
+
+//--------------------------------------- ConnectK_Board Implementation
+
+ConnectK_Board::ConnectK_Board(int rows, int columns, int k)
+    : Board<char>(rows, columns), rules(rows, columns, k) {
+    fill_cells(blank_symbol);
+}
+
+int ConnectK_Board::find_lowest_row(int col) const {
+    return heights[col] < rows ? rows - 1 - heights[col] : -1;
+}
+
+void ConnectK_Board::set_cell(int x, int y, const char& value) {
+    bool was_empty = board[x][y] == blank_symbol;
+    Board<char>::set_cell(x, y, value);
+
+    ConnectK_Bits<WORDS> bit;
+    bit.set(rules.bit(y, rows - 1 - x));
+    if (was_empty && value != blank_symbol) {
+        if (position.moves == 0) first_symbol = value;
+        position.play(bit);
+        heights[y]++;
+    } else if (!was_empty && value == blank_symbol) {
+        position.undo(bit);
+        heights[y]--;
+        if (position.moves == 0) first_symbol = 0;
+    }
+}
+
+ConnectK_Bits<ConnectK_Board::WORDS> ConnectK_Board::stones_of(char symbol) const {
+    if (first_symbol == 0) return ConnectK_Bits<WORDS>();
+    // The first player is to move after an even number of stones
+    bool first_to_move = position.moves % 2 == 0;
+    return (symbol == first_symbol) == first_to_move ? position.current : position.opponent();
+}
+
+bool ConnectK_Board::update_board(const Move<char>& move) {
+    int col = move.get_y();
+    char mark = move.get_symbol();
+
+    if (col < 0 || col >= columns) {
+        if (!quiet) cout << "Invalid column! Please choose between 0 and " << (columns - 1) << "\n";
+        return false;
+    }
+
+    int row = find_lowest_row(col);
+
+    if (row == -1) {
+        if (!quiet) cout << "Column " << col << " is full! Choose another column.\n";
+        return false;
+    }
+
+    set_cell(row, col, mark);
+    n_moves++;
+    return true;
+}
+
+bool ConnectK_Board::check_k_in_row(char symbol) const {
+    return rules.alignment(stones_of(symbol));
+}
+
+bool ConnectK_Board::is_win(Player<char>* player) {
+    return check_k_in_row(player->get_symbol());
+}
+
+bool ConnectK_Board::is_lose(Player<char>* /*player*/) {
+    return false;
+}
+
+bool ConnectK_Board::is_draw(Player<char>* /*player*/) {
+    if (n_moves < rows * columns) return false;
+    return !check_k_in_row('X') && !check_k_in_row('O');
+}
+
+bool ConnectK_Board::game_is_over(Player<char>* /*player*/) {
+    return check_k_in_row('X') ||
+           check_k_in_row('O') ||
+           (n_moves >= rows * columns);
+}
+
+GameOutcome ConnectK_Board::outcome_after(const Move<char>& last_move) {
+    // Only the player who just moved can have completed a line
+    if (check_k_in_row(last_move.get_symbol()))
+        return GameOutcome::WIN;
+    return n_moves >= rows * columns ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void ConnectK_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    // A column is playable while it has room
+    moves.clear();
+    for (int j = 0; j < columns; j++)
+        if (heights[j] < rows)
+            moves.push_back(Move<char>(0, j, player->get_symbol()));
+}
+
+//--------------------------------------- ConnectK_UI Implementation
+
+ConnectK_UI::ConnectK_UI() : ValidatedUI<char>(
+    "=== Welcome to Connect-K ===\n"
+    "Rules: Get k marks in a row to win!\n"
+    "Choose a column and your piece will fall to the bottom.", 3) {}
+
+void ConnectK_UI::get_board_settings(int& rows, int& columns, int& k) {
+    rows = get_validated_int("Number of rows (4-16): ", 4, ConnectK_Board::MAX_SIDE);
+    columns = get_validated_int("Number of columns (4-16): ", 4, ConnectK_Board::MAX_SIDE);
+    int longest = rows > columns ? rows : columns;
+    k = get_validated_int("Marks in a row to win (3-" + to_string(longest) + "): ", 3, longest);
+}
+
+PlayerType ConnectK_UI::get_player_type_choice(string player_label, const vector<string>& options) {
+    cout << "Choose " << player_label << " type:\n";
+    for (size_t i = 0; i < options.size(); ++i)
+        cout << i + 1 << ". " << options[i] << "\n";
+
+    int choice = get_menu_choice("Enter choice: ", (int)options.size());
+    clear_input_buffer();
+    return choice == 2 ? PlayerType::AI : PlayerType::HUMAN;
+}
+
+Player<char>** ConnectK_UI::setup_players() {
+    Player<char>** players = new Player<char>*[2];
+    vector<string> type_options = { "Human", "AI (Smart)" };
+
+    string nameX = get_player_name("Player X");
+    PlayerType typeX = get_player_type_choice("Player X", type_options);
+    players[0] = create_player(nameX, 'X', typeX);
+
+    string nameO = get_player_name("Player O");
+    PlayerType typeO = get_player_type_choice("Player O", type_options);
+    players[1] = create_player(nameO, 'O', typeO);
+
+    return players;
+}
+
+Player<char>* ConnectK_UI::create_player(string& name, char symbol, PlayerType type) {
+    if (type == PlayerType::AI) {
+        cout << "Creating AI player: " << name << " (" << symbol << ")\n";
+        return new ConnectK_AI_Player(name, symbol);
+    } else {
+        cout << "Creating human player: " << name << " (" << symbol << ")\n";
+        return new Player<char>(name, symbol, type);
+    }
+}
+
+Move<char> ConnectK_UI::get_move(Player<char>* player) {
+    int col;
+    int last = player->get_board_ptr()->get_columns() - 1;
+
+    if (player->get_type() == PlayerType::AI) {
+        ConnectK_AI_Player* ai_player = dynamic_cast<ConnectK_AI_Player*>(player);
+
+        cout << "\nAI " << player->get_name() << " is thinking...\n";
+        col = ai_player->get_best_column();
+
+        cout << "AI " << player->get_name() << " (" << player->get_symbol()
+             << ") plays column: " << col << endl;
+    } else {
+        col = get_validated_int(
+            "\n" + player->get_name() + " (" + string(1, player->get_symbol()) +
+            "), choose a column (0-" + to_string(last) + "): ",
+            0, last
+        );
+    }
+
+    return Move<char>(0, col, player->get_symbol());
+}
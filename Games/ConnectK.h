@@ -0,0 +1,166 @@
+/**
+ * @file ConnectK.h
+ * @brief Connect-k on a gravity board of any size up to 16x16
+ * Generalizes Four-in-a-Row: rows, columns and the line length k are
+ * chosen when the game starts (Connect-5 on 9x9, for example).
+ * Players drop marks into the lowest available square of any column.
+ * Win condition: k marks in a row (horizontally, vertically, or diagonally)
+ */
+
+#ifndef CONNECT_K_H
+#define CONNECT_K_H
+
+#include "BoardGame_Classes.h"
+#include "ValidatedUI.h"
+#include "ConnectK_Position.h"
+#include <string>
+
+using namespace std;
+
+/**
+ * @class ConnectK_Board
+ * @brief Board class for connect-k
+ *
+ * Like FourInARow_Board, the game state proper is a bitboard position
+ * (the widest one, ConnectK_Board::WORDS words) and the height of each
+ * column, kept in step with the char cells by set_cell(). Turns are
+ * assumed to alternate.
+ */
+class ConnectK_Board : public Board<char> {
+public:
+    static const int MAX_SIDE = ConnectK_Rules<1>::MAX_SIDE;  ///< Largest number of rows or columns
+    static const int WORDS = (MAX_SIDE * (MAX_SIDE + 1) + 63) / 64; ///< Words of the widest bitboard
+
+private:
+    char blank_symbol = ' ';            ///< Character for empty cell
+    ConnectK_Rules<WORDS> rules;        ///< Geometry and line detection
+    ConnectK_Position<WORDS> position;  ///< Both players' stones, side to move first
+    int heights[MAX_SIDE] = {};         ///< Stones in each column
+    char first_symbol = 0;              ///< Symbol of the first stone (0 on an empty board)
+
+    /**
+     * @brief Find the lowest available row in a column
+     * @param col The column to check
+     * @return Row index of lowest empty cell, or -1 if column is full
+     */
+    int find_lowest_row(int col) const;
+
+    /**
+     * @brief Bitboard of the stones with the given symbol
+     */
+    ConnectK_Bits<WORDS> stones_of(char symbol) const;
+
+    /**
+     * @brief Check if a player has k in a row
+     * @param symbol The symbol to check
+     * @return true if k-in-a-row exists
+     */
+    bool check_k_in_row(char symbol) const;
+
+protected:
+    /**
+     * @brief Write a cell and drop or lift the matching stone in the bitboard
+     */
+    void set_cell(int x, int y, const char& value) override;
+
+public:
+    /**
+     * @brief Constructor
+     * @param rows Rows of the board (4 to MAX_SIDE)
+     * @param columns Columns of the board (4 to MAX_SIDE)
+     * @param k Marks in a row needed to win (3 to max(rows, columns))
+     */
+    ConnectK_Board(int rows = 6, int columns = 7, int k = 4);
+
+    /**
+     * @brief Update board with a move
+     * Only the column (y) matters; the mark falls to the lowest empty row
+     */
+    bool update_board(const Move<char>& move) override;
+
+    /**
+     * @brief Check if player has won
+     */
+    bool is_win(Player<char>* player) override;
+
+    /**
+     * @brief Check if player has lost (not used in this game)
+     */
+    bool is_lose(Player<char>* player) override;
+
+    /**
+     * @brief Check if game is a draw (board full)
+     */
+    bool is_draw(Player<char>* player) override;
+
+    /**
+     * @brief Check if game is over
+     */
+    bool game_is_over(Player<char>* player) override;
+
+    /**
+     * @brief Win check limited to the player who just moved
+     */
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+
+    /**
+     * @brief Legal moves: one per column with room (only y is meaningful)
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
+
+    /** @brief Marks in a row needed to win. */
+    int get_k() const { return rules.k; }
+
+    /** @brief Geometry of the board as the bitboard rules see it. */
+    const ConnectK_Rules<WORDS>& get_rules() const { return rules; }
+
+    /** @brief The live bitboard position, with the player to move as "current". */
+    const ConnectK_Position<WORDS>& get_position() const { return position; }
+};
+
+/**
+ * @class ConnectK_UI
+ * @brief UI class for connect-k
+ */
+class ConnectK_UI : public ValidatedUI<char> {
+public:
+    /**
+     * @brief Constructor
+     */
+    ConnectK_UI();
+
+    /**
+     * @brief Destructor
+     */
+    ~ConnectK_UI() {}
+
+    /**
+     * @brief Ask for the board size and the line length
+     */
+    void get_board_settings(int& rows, int& columns, int& k);
+
+    /**
+     * @brief Create a player based on type (supports AI)
+     */
+    Player<char>* create_player(string& name, char symbol, PlayerType type) override;
+
+    /**
+     * @brief Setup players with AI option
+     * @return Array of two players
+     */
+    Player<char>** setup_players() override;
+
+    /**
+     * @brief Get move from player (human or AI)
+     * Players only choose a column
+     */
+    Move<char> get_move(Player<char>* player) override;
+
+protected:
+    /**
+     * @brief Override to add AI option
+     */
+    PlayerType get_player_type_choice(string player_label, const vector<string>& options) override;
+};
+
+#endif // CONNECT_K_H
@@ -0,0 +1,279 @@
+// ConnectK_AI_Player.h
+// AI player for connect-k on any board up to 16x16, using alpha-beta search on multi-word bitboards
+
+#ifndef CONNECT_K_AI_PLAYER_H
+#define CONNECT_K_AI_PLAYER_H
+
+#include "BoardGame_Classes.h"
+#include "ConnectK.h"
+#include "ConnectK_Position.h"
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief AI Player for connect-k using iterative deepening alpha-beta search
+ *
+ * The search runs on the smallest bitboard that holds the board: one
+ * 64-bit word up to 7x7, two words for 9x9, up to five for 16x16, so a
+ * small board pays nothing for the large ones. Each node finds immediate
+ * wins, forced blocks and cells under an opponent threat with whole-board
+ * shifts, and leaves are scored by counting open windows of k cells
+ * (ConnectK_Rules::evaluate()). Larger boards have more columns and
+ * costlier words, so they simply reach fewer plies in the time budget.
+ *
+ * Results go into a transposition table kept for the whole game; move
+ * ordering tries the table move first, then columns by history score with
+ * center-out tie-breaks.
+ */
+class ConnectK_AI_Player : public Player<char> {
+private:
+    static const int MAX_SIDE = ConnectK_Board::MAX_SIDE;
+    static const int WIN_SCORE = 1 << 28;        // Score of a won position, less the plies to the win
+    static const int MATE_BOUND = WIN_SCORE / 2; // Scores past this are wins or losses
+    static const int INFINITE_SCORE = 1 << 30;   // Above any reachable score, safe to negate
+    static const int TT_BITS = 20;               // log2 of the table size
+
+    enum Bound : uint8_t { NONE = 0, EXACT, LOWER, UPPER };
+
+    /** @brief One transposition table slot. */
+    struct TTEntry {
+        uint64_t key = 0;
+        int32_t score = 0;
+        int8_t depth = -1;
+        Bound bound = NONE;
+        int8_t best_col = -1;
+    };
+
+    vector<TTEntry> tt;               // Search results, kept for the whole game
+    int history[2][MAX_SIDE] = {};    // Cutoff credit per side (by stone parity) and column
+    int time_budget_ms = 300;         // Thinking time per move
+    int depth_limit = 0;              // Deepest iteration to run (0 = no limit)
+    int completed_depth = 0;          // Depth of the result played by the last move
+    int completed_score = 0;          // Its score for the AI
+    unsigned long long nodes = 0;     // Nodes searched for the last move
+    chrono::steady_clock::time_point deadline;
+    bool stopped = false;
+
+    /** @brief Scores of wins and losses count from the stored node, not the root. */
+    static int score_to_tt(int score, int ply) {
+        return score > MATE_BOUND ? score + ply : score < -MATE_BOUND ? score - ply : score;
+    }
+
+    static int score_from_tt(int score, int ply) {
+        return score > MATE_BOUND ? score - ply : score < -MATE_BOUND ? score + ply : score;
+    }
+
+    /**
+     * @brief Columns holding a bit of moves, best first
+     * @return Number of columns written to order
+     */
+    template <int W>
+    int order_moves(const ConnectK_Rules<W>& rules, const ConnectK_Bits<W>& moves,
+                    int side, int tt_col, int order[]) const {
+        int keys[MAX_SIDE];
+        int n = 0;
+        for (int c = 0; c < rules.columns; c++) {
+            if (!(moves & rules.column_masks[c]).any()) continue;
+            int center = abs(2 * c - (rules.columns - 1));
+            int key = c == tt_col ? INFINITE_SCORE : history[side][c] * 64 - center;
+            int i = n++;
+            for (; i > 0 && keys[i - 1] < key; i--) {
+                keys[i] = keys[i - 1];
+                order[i] = order[i - 1];
+            }
+            keys[i] = key;
+            order[i] = c;
+        }
+        return n;
+    }
+
+    /**
+     * @brief Moves worth searching: wins are handled by the caller
+     *
+     * A single opponent threat must be blocked; two can't be. A cell right
+     * under an opponent threat hands them the win, so it is left out.
+     * @return Candidate moves, empty if every move loses
+     */
+    template <int W>
+    static ConnectK_Bits<W> candidate_moves(const ConnectK_Rules<W>& rules,
+                                            const ConnectK_Position<W>& pos,
+                                            const ConnectK_Bits<W>& possible) {
+        ConnectK_Bits<W> threats = rules.winning_cells(pos.opponent(), pos.mask);
+        ConnectK_Bits<W> forced = threats & possible;
+        if (forced.any()) {
+            if (forced.count() > 1) return ConnectK_Bits<W>();
+            return forced.andnot(threats.shr(1));
+        }
+        return possible.andnot(threats.shr(1));
+    }
+
+    /**
+     * @brief Negamax alpha-beta search
+     * @return Score for the side to move
+     */
+    template <int W>
+    int negamax(const ConnectK_Rules<W>& rules, const ConnectK_Position<W>& pos,
+                int depth, int alpha, int beta, int ply) {
+        if ((++nodes & 1023) == 0 && chrono::steady_clock::now() >= deadline) stopped = true;
+        if (stopped) return 0;
+
+        ConnectK_Bits<W> possible = rules.possible(pos);
+        if ((rules.winning_cells(pos.current, pos.mask) & possible).any())
+            return WIN_SCORE - ply - 1;
+        if (pos.moves >= rules.rows * rules.columns - 1) return 0; // The last stone can't win
+
+        ConnectK_Bits<W> moves = candidate_moves(rules, pos, possible);
+        if (!moves.any()) return -(WIN_SCORE - ply - 2);
+        if (depth <= 0) {
+            int eval = rules.evaluate(pos);
+            return eval > MATE_BOUND - 1 ? MATE_BOUND - 1 : eval < 1 - MATE_BOUND ? 1 - MATE_BOUND : eval;
+        }
+
+        uint64_t key = pos.key();
+        TTEntry& entry = tt[key >> (64 - TT_BITS)];
+        int tt_col = -1;
+        if (entry.key == key) {
+            tt_col = entry.best_col;
+            if (entry.depth >= depth) {
+                int score = score_from_tt(entry.score, ply);
+                if (entry.bound == EXACT ||
+                    (entry.bound == LOWER && score >= beta) ||
+                    (entry.bound == UPPER && score <= alpha))
+                    return score;
+            }
+        }
+
+        int side = pos.moves & 1;
+        int order[MAX_SIDE];
+        int n = order_moves(rules, moves, side, tt_col, order);
+        int alpha_orig = alpha, best = -INFINITE_SCORE, best_col = -1;
+
+        for (int i = 0; i < n; i++) {
+            ConnectK_Position<W> child = pos;
+            child.play(moves & rules.column_masks[order[i]]);
+            int score = -negamax(rules, child, depth - 1, -beta, -alpha, ply + 1);
+            if (stopped) return 0;
+
+            if (score > best) {
+                best = score;
+                best_col = order[i];
+            }
+            if (score > alpha) alpha = score;
+            if (alpha >= beta) {
+                history[side][order[i]] += depth * depth;
+                break;
+            }
+        }
+
+        if (entry.key != key || entry.depth <= depth) {
+            entry.key = key;
+            entry.score = score_to_tt(best, ply);
+            entry.depth = depth;
+            entry.bound = best <= alpha_orig ? UPPER : best >= beta ? LOWER : EXACT;
+            entry.best_col = best_col;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Iterative deepening from the root; returns the column to play
+     */
+    template <int W>
+    int search(const ConnectK_Rules<W>& rules, const ConnectK_Position<W>& pos) {
+        ConnectK_Bits<W> possible = rules.possible(pos);
+        ConnectK_Bits<W> wins = rules.winning_cells(pos.current, pos.mask) & possible;
+        if (wins.any()) return wins.lowest() / rules.stride;
+
+        // When every move loses, still play one (the search below needs candidates)
+        ConnectK_Bits<W> moves = candidate_moves(rules, pos, possible);
+        if (!moves.any()) moves = possible;
+
+        int side = pos.moves & 1;
+        int order[MAX_SIDE];
+        int n = order_moves(rules, moves, side, -1, order);
+        if (n == 0) return rules.columns / 2; // Full board: nothing to choose
+        int best_col = order[0];
+        if (n == 1) return best_col;
+
+        int max_depth = rules.rows * rules.columns - pos.moves;
+        if (depth_limit > 0 && depth_limit < max_depth) max_depth = depth_limit;
+
+        for (int depth = 1; depth <= max_depth; depth++) {
+            n = order_moves(rules, moves, side, best_col, order);
+            int alpha = -INFINITE_SCORE, iteration_col = -1;
+            for (int i = 0; i < n; i++) {
+                ConnectK_Position<W> child = pos;
+                child.play(moves & rules.column_masks[order[i]]);
+                int score = -negamax(rules, child, depth - 1, -INFINITE_SCORE, -alpha, 1);
+                if (stopped) break;
+                if (score > alpha) {
+                    alpha = score;
+                    iteration_col = order[i];
+                }
+            }
+            if (stopped) break;
+
+            best_col = iteration_col;
+            completed_depth = depth;
+            completed_score = alpha;
+            if (alpha > MATE_BOUND || alpha < -MATE_BOUND) break; // Decided
+        }
+        return best_col;
+    }
+
+public:
+    /**
+     * @brief Constructor for AI player
+     * @param name Player name
+     * @param symbol Player symbol ('X' or 'O')
+     */
+    ConnectK_AI_Player(string name, char symbol)
+        : Player<char>(name, symbol, PlayerType::AI), tt(size_t(1) << TT_BITS) {}
+
+    /**
+     * @brief Get best move for the board the player is attached to
+     */
+    int get_best_column() {
+        const ConnectK_Board* board = dynamic_cast<const ConnectK_Board*>(boardPtr);
+        const auto& wide_rules = board->get_rules();
+        const auto& wide = board->get_position();
+
+        nodes = 0;
+        stopped = false;
+        completed_depth = 0;
+        completed_score = 0;
+        for (auto& side : history)
+            for (int& h : side) h /= 2;
+        deadline = chrono::steady_clock::now() + chrono::milliseconds(time_budget_ms);
+
+        // Search on the narrowest bitboard that holds the board
+        int rows = wide_rules.rows, columns = wide_rules.columns, k = wide_rules.k;
+        switch (ConnectK_Rules<1>::words_needed(rows, columns)) {
+            case 1: return search(ConnectK_Rules<1>(rows, columns, k), ConnectK_Position<1>::narrow(wide));
+            case 2: return search(ConnectK_Rules<2>(rows, columns, k), ConnectK_Position<2>::narrow(wide));
+            case 3: return search(ConnectK_Rules<3>(rows, columns, k), ConnectK_Position<3>::narrow(wide));
+            case 4: return search(ConnectK_Rules<4>(rows, columns, k), ConnectK_Position<4>::narrow(wide));
+            default: return search(wide_rules, wide);
+        }
+    }
+
+    /** @brief Set the thinking time per move (milliseconds). */
+    void set_time_budget(int ms) { time_budget_ms = ms; }
+
+    /** @brief Stop deepening after this many plies (0 = only the clock limits). */
+    void set_depth_limit(int depth) { depth_limit = depth; }
+
+    /** @brief Depth of the search behind the last move. */
+    int get_completed_depth() const { return completed_depth; }
+
+    /** @brief Score of the last move for the AI (wins are above 2^27). */
+    int get_score() const { return completed_score; }
+
+    /** @brief Nodes searched for the last move. */
+    unsigned long long get_nodes() const { return nodes; }
+};
+
+#endif // CONNECT_K_AI_PLAYER_H
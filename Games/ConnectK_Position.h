@@ -0,0 +1,331 @@
+// ConnectK_Position.h
+// Multi-word bitboards for connect-k on gravity boards up to 16x16
+
+#ifndef CONNECT_K_POSITION_H
+#define CONNECT_K_POSITION_H
+
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief W 64-bit words used as one bitboard.
+ *
+ * Every operation is a fixed-length loop over the words with no data
+ * dependent branches, so the compiler unrolls it and, for W >= 2, turns
+ * it into vector instructions. Shifts move bits across word boundaries.
+ */
+template <int W>
+struct ConnectK_Bits {
+    static const int BITS = 64 * W;
+    uint64_t w[W] = {};
+
+    /** @brief Copy the low W words of a wider (or equal) bitboard. */
+    template <int V>
+    static ConnectK_Bits narrow(const ConnectK_Bits<V>& other) {
+        static_assert(V >= W, "narrow() only drops words");
+        ConnectK_Bits r;
+        for (int i = 0; i < W; i++) r.w[i] = other.w[i];
+        return r;
+    }
+
+    void set(int bit) { w[bit >> 6] |= uint64_t(1) << (bit & 63); }
+    void reset(int bit) { w[bit >> 6] &= ~(uint64_t(1) << (bit & 63)); }
+    bool test(int bit) const { return (w[bit >> 6] >> (bit & 63)) & 1; }
+
+    bool any() const {
+        uint64_t a = 0;
+        for (int i = 0; i < W; i++) a |= w[i];
+        return a != 0;
+    }
+
+    int count() const {
+        int c = 0;
+        for (int i = 0; i < W; i++) c += __builtin_popcountll(w[i]);
+        return c;
+    }
+
+    /** @brief Index of the lowest set bit, or -1 if none. */
+    int lowest() const {
+        for (int i = 0; i < W; i++)
+            if (w[i]) return i * 64 + __builtin_ctzll(w[i]);
+        return -1;
+    }
+
+    ConnectK_Bits operator&(const ConnectK_Bits& o) const {
+        ConnectK_Bits r;
+        for (int i = 0; i < W; i++) r.w[i] = w[i] & o.w[i];
+        return r;
+    }
+
+    ConnectK_Bits operator|(const ConnectK_Bits& o) const {
+        ConnectK_Bits r;
+        for (int i = 0; i < W; i++) r.w[i] = w[i] | o.w[i];
+        return r;
+    }
+
+    ConnectK_Bits operator^(const ConnectK_Bits& o) const {
+        ConnectK_Bits r;
+        for (int i = 0; i < W; i++) r.w[i] = w[i] ^ o.w[i];
+        return r;
+    }
+
+    /** @brief Bits of this that are not in o. */
+    ConnectK_Bits andnot(const ConnectK_Bits& o) const {
+        ConnectK_Bits r;
+        for (int i = 0; i < W; i++) r.w[i] = w[i] & ~o.w[i];
+        return r;
+    }
+
+    ConnectK_Bits& operator&=(const ConnectK_Bits& o) { return *this = *this & o; }
+    ConnectK_Bits& operator|=(const ConnectK_Bits& o) { return *this = *this | o; }
+    ConnectK_Bits& operator^=(const ConnectK_Bits& o) { return *this = *this ^ o; }
+
+    bool operator==(const ConnectK_Bits& o) const {
+        uint64_t d = 0;
+        for (int i = 0; i < W; i++) d |= w[i] ^ o.w[i];
+        return d == 0;
+    }
+
+    /** @brief Sum as one W*64-bit integer (carries cross words). */
+    ConnectK_Bits operator+(const ConnectK_Bits& o) const {
+        ConnectK_Bits r;
+        unsigned long long carry = 0;
+        for (int i = 0; i < W; i++) {
+            unsigned long long s;
+            unsigned long long c1 = __builtin_uaddll_overflow(w[i], o.w[i], &s);
+            unsigned long long c2 = __builtin_uaddll_overflow(s, carry, &s);
+            r.w[i] = s;
+            carry = c1 | c2;
+        }
+        return r;
+    }
+
+    /** @brief Move every bit n places towards bit 0. */
+    ConnectK_Bits shr(int n) const {
+        ConnectK_Bits r;
+        int q = n >> 6, b = n & 63;
+        if (b == 0) {
+            for (int i = 0; i + q < W; i++) r.w[i] = w[i + q];
+        } else {
+            for (int i = 0; i + q < W; i++)
+                r.w[i] = (w[i + q] >> b) | (i + q + 1 < W ? w[i + q + 1] << (64 - b) : 0);
+        }
+        return r;
+    }
+
+    /** @brief Move every bit n places away from bit 0 (bits past the top are lost). */
+    ConnectK_Bits shl(int n) const {
+        ConnectK_Bits r;
+        int q = n >> 6, b = n & 63;
+        if (b == 0) {
+            for (int i = q; i < W; i++) r.w[i] = w[i - q];
+        } else {
+            for (int i = q; i < W; i++)
+                r.w[i] = (w[i - q] << b) | (i - q - 1 >= 0 ? w[i - q - 1] >> (64 - b) : 0);
+        }
+        return r;
+    }
+};
+
+/**
+ * @brief A connect-k position: stones of the side to move and of both sides.
+ *
+ * Same encoding as FourInARow_Position, with more words: cell (column c,
+ * height h from the floor) is bit c * (rows + 1) + h. The spare bit on
+ * top of each column is never set, so lines can't wrap from one column
+ * into the next. Turns alternate, so play() only swaps the point of view.
+ */
+template <int W>
+class ConnectK_Position {
+public:
+    ConnectK_Bits<W> current; ///< Stones of the side to move
+    ConnectK_Bits<W> mask;    ///< Stones of both sides
+    int moves = 0;            ///< Stones on the board
+
+    /** @brief Stones of the side that just moved. */
+    ConnectK_Bits<W> opponent() const { return mask ^ current; }
+
+    /** @brief Drop move (one bit, on top of a column) for the side to move. */
+    void play(const ConnectK_Bits<W>& move) {
+        current ^= mask;
+        mask |= move;
+        moves++;
+    }
+
+    /** @brief Take back move, the last stone played (inverse of play()). */
+    void undo(const ConnectK_Bits<W>& move) {
+        mask ^= move;
+        current ^= mask;
+        moves--;
+    }
+
+    /** @brief Hash of the position (not unique, mixes every word). */
+    uint64_t key() const {
+        uint64_t h = uint64_t(moves) * 0x9E3779B97F4A7C15ULL;
+        for (int i = 0; i < W; i++) {
+            h ^= current.w[i] + 0x632BE59BD9B4E019ULL + (h << 6) + (h >> 2);
+            h ^= mask.w[i] * 0xBF58476D1CE4E5B9ULL;
+            h = (h ^ (h >> 31)) * 0x94D049BB133111EBULL;
+        }
+        return h;
+    }
+
+    /** @brief The same position on a narrower bitboard (the board must fit in W words). */
+    template <int V>
+    static ConnectK_Position narrow(const ConnectK_Position<V>& other) {
+        ConnectK_Position r;
+        r.current = ConnectK_Bits<W>::narrow(other.current);
+        r.mask = ConnectK_Bits<W>::narrow(other.mask);
+        r.moves = other.moves;
+        return r;
+    }
+};
+
+/**
+ * @brief Board geometry and the bitboard rules of connect-k on it.
+ *
+ * Holds the masks the rules need (floor, board cells, each column) and
+ * finds lines with shift-and-AND: after a run of doublings, a bit is left
+ * where k stones start in a row. The same shifts give every empty cell
+ * that would complete a line, and a bit-sliced counter over the k shifted
+ * copies counts the stones in every window of k cells at once.
+ */
+template <int W>
+class ConnectK_Rules {
+public:
+    static const int MAX_SIDE = 16;   ///< Largest number of rows or columns
+    static const int DIRECTIONS = 4;
+    static const int COUNT_PLANES = 5; ///< Bits of a window count (k <= 16)
+
+    typedef ConnectK_Bits<W> Bits;
+    typedef ConnectK_Position<W> Position;
+
+    int rows, columns, k, stride;
+    Bits bottom;                   ///< Lowest cell of every column
+    Bits board;                    ///< Every cell of the board
+    Bits column_masks[MAX_SIDE];   ///< Cells of each column
+    int steps[DIRECTIONS];         ///< Bit distance to the next cell: up, right, down-right, up-right
+    int window_weight[MAX_SIDE];   ///< Evaluation of an open window holding n own stones
+
+    /**
+     * @brief Number of words a rows x columns board needs.
+     */
+    static int words_needed(int rows, int columns) {
+        return (columns * (rows + 1) + 63) / 64;
+    }
+
+    ConnectK_Rules(int rows, int columns, int k)
+        : rows(rows), columns(columns), k(k), stride(rows + 1) {
+        for (int c = 0; c < columns; c++) {
+            bottom.set(c * stride);
+            for (int h = 0; h < rows; h++) column_masks[c].set(c * stride + h);
+            board |= column_masks[c];
+        }
+        steps[0] = 1;
+        steps[1] = stride;
+        steps[2] = stride - 1;
+        steps[3] = stride + 1;
+
+        // Each missing stone divides the value of a window by 8
+        window_weight[0] = 0;
+        for (int n = 1; n < MAX_SIDE; n++) {
+            int missing = k - n;
+            window_weight[n] = missing < 1 ? 0 : missing <= 4 ? 1024 >> (3 * (missing - 1)) : 1;
+        }
+    }
+
+    /** @brief Bit of the cell at height h of column c. */
+    int bit(int c, int h) const { return c * stride + h; }
+
+    /** @brief Lowest empty cell of every column that has room. */
+    Bits possible(const Position& pos) const { return (pos.mask + bottom) & board; }
+
+    /**
+     * @brief First cell of every run of k set bits along step.
+     */
+    Bits line_starts(Bits b, int step) const {
+        int len = 1;
+        while (2 * len <= k) {
+            b &= b.shr(len * step);
+            len *= 2;
+        }
+        if (len < k) b &= b.shr((k - len) * step);
+        return b;
+    }
+
+    /** @brief Whether stones hold k in a row in any direction. */
+    bool alignment(const Bits& stones) const {
+        for (int d = 0; d < DIRECTIONS; d++)
+            if (line_starts(stones, steps[d]).any()) return true;
+        return false;
+    }
+
+    /**
+     * @brief Empty cells where one more stone completes a line for stones
+     *
+     * For each direction and each slot j of a window, AND the k-1 shifted
+     * copies other than j (prefix and suffix products keep it O(k)), then
+     * shift the result onto slot j.
+     */
+    Bits winning_cells(const Bits& stones, const Bits& mask) const {
+        Bits cells;
+        Bits shifted[MAX_SIDE], suffix[MAX_SIDE + 1];
+        for (int d = 0; d < DIRECTIONS; d++) {
+            int step = steps[d];
+            for (int i = 0; i < k; i++) shifted[i] = stones.shr(i * step);
+            suffix[k] = board;
+            for (int i = k - 1; i >= 0; i--) suffix[i] = suffix[i + 1] & shifted[i];
+            Bits prefix = board;
+            for (int j = 0; j < k; j++) {
+                cells |= (prefix & suffix[j + 1]).shl(j * step);
+                prefix &= shifted[j];
+            }
+        }
+        return cells & board.andnot(mask);
+    }
+
+    /** @brief Whether the side to move completes a line by dropping move. */
+    bool is_winning_move(const Position& pos, const Bits& move) const {
+        return alignment(pos.current | move);
+    }
+
+    /**
+     * @brief Weighted count of windows of k cells open to own (none of other's stones)
+     */
+    int window_score(const Bits& own, const Bits& other) const {
+        int score = 0;
+        Bits open = board.andnot(other);
+        for (int d = 0; d < DIRECTIONS; d++) {
+            int step = steps[d];
+            Bits starts = line_starts(open, step);
+            if (!starts.any()) continue;
+
+            // Bit-sliced counter: planes[p] holds bit p of each window's stone count
+            Bits planes[COUNT_PLANES];
+            for (int i = 0; i < k; i++) {
+                Bits carry = own.shr(i * step) & starts;
+                for (int p = 0; p < COUNT_PLANES && carry.any(); p++) {
+                    Bits next = planes[p] & carry;
+                    planes[p] ^= carry;
+                    carry = next;
+                }
+            }
+            for (int n = 1; n < k; n++) {
+                Bits windows = starts;
+                for (int p = 0; p < COUNT_PLANES; p++)
+                    windows = (n >> p & 1) ? windows & planes[p] : windows.andnot(planes[p]);
+                score += window_weight[n] * windows.count();
+            }
+        }
+        return score;
+    }
+
+    /** @brief Heuristic value for the side to move. */
+    int evaluate(const Position& pos) const {
+        Bits other = pos.opponent();
+        return window_score(pos.current, other) - window_score(other, pos.current);
+    }
+};
+
+#endif // CONNECT_K_POSITION_H
@@ -6,37 +6,33 @@
 using namespace std;
 
 // Diamond_board implementation
-Diamond_board::Diamond_board() : Board<char>(7, 7) {
-    for (auto& row : board) {
-        for (auto& cell : row) {
-            cell = ' ';
-        }
-    }
+Diamond_board::Diamond_board() : FixedBoard() {
+    fill_cells(' ');
 }
-bool Diamond_board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char symbol = move->get_symbol();
+bool Diamond_board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char symbol = move.get_symbol();
 
     // Check bounds
     if (x < 0 || x >= rows || y < 0 || y >= columns) {
-        cout << "Invalid position! Row must be 0-6, column 0-6.\n";
+        if (!quiet) cout << "Invalid position! Row must be 0-6, column 0-6.\n";
         return false;
     }
 
     // Check if cell is part of diamond
     if (!is_playable_cell(x, y)) {
-        cout << "That position is not part of the diamond!\n";
+        if (!quiet) cout << "That position is not part of the diamond!\n";
         return false;
     }
 
     // Check if cell is empty
     if (board[x][y] != ' ') {
-        cout << "Cell already occupied!\n";
+        if (!quiet) cout << "Cell already occupied!\n";
         return false;
     }
 
-    board[x][y] = symbol;
+    set_cell(x, y, symbol);
     n_moves++;
     return true;
 }
@@ -51,7 +47,7 @@ bool Diamond_board::count_three_in_row(char symbol) {
     // Check all positions
     for (int x = 0; x < 7; x++) {
         for (int y = 0; y < 7; y++) {
-            if (!is_playable_cell(x, y) || board[x][y] != symbol)
+            if (!is_playable_cell(x, y) || at(x, y) != symbol)
                 continue;
 
             // Check all directions
@@ -65,7 +61,7 @@ bool Diamond_board::count_three_in_row(char symbol) {
 
                     if (nx < 0 || nx >= 7 || ny < 0 || ny >= 7 ||
                         !is_playable_cell(nx, ny) ||
-                        board[nx][ny] != symbol) {
+                        at(nx, ny) != symbol) {
                         valid_three = false;
                         break;
                     }
@@ -85,7 +81,7 @@ bool Diamond_board::count_three_in_row(char symbol) {
 
                     if (nx < 0 || nx >= 7 || ny < 0 || ny >= 7 ||
                         !is_playable_cell(nx, ny) ||
-                        board[nx][ny] != symbol) {
+                        at(nx, ny) != symbol) {
                         valid_four = false;
                         break;
                     }
@@ -151,6 +147,14 @@ bool Diamond_board::game_is_over(Player<char>* player) {
     return is_win(player) || is_lose(player) || is_draw(player);
 }
 
+void Diamond_board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLUMNS; j++)
+            if (is_playable_cell(i, j) && at(i, j) == ' ')
+                moves.push_back(Move<char>(i, j, player->get_symbol()));
+}
+
 // Diamond_UI implementation
 pair<int, int> Diamond_UI::display_to_matrix(int display_row, int display_col) const {
     // Map display coordinates to actual matrix coordinates
@@ -185,7 +189,7 @@ Player<char>* Diamond_UI::create_player(string& name, char symbol, PlayerType ty
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Diamond_UI::get_move(Player<char>* player) {
+Move<char> Diamond_UI::get_move(Player<char>* player) {
     Diamond_board* dboard = dynamic_cast<Diamond_board*>(player->get_board_ptr());
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -240,34 +244,25 @@ Move<char>* Diamond_UI::get_move(Player<char>* player) {
             break;
         }
 
-        return new Move<char>(row, col, player->get_symbol());
+        return Move<char>(row, col, player->get_symbol());
     }
     else {
         // COMPUTER PLAYER
-        // Get list of all empty playable cells
-        vector<pair<int, int>> empty_cells;
-
-        for (int row = 0; row < 7; row++) {
-            for (int col = 0; col < 7; col++) {
-                if (dboard->is_playable_cell(row, col) &&
-                    dboard->get_cell(row, col) == ' ') {
-                    empty_cells.push_back({row, col});
-                }
-            }
-        }
+        // Pick a random empty playable cell
+        MoveList<char> moves;
+        dboard->generate_moves(player, moves);
 
-        if (empty_cells.empty()) {
+        if (moves.empty()) {
             cout << "Computer has no valid moves!\n";
-            return new Move<char>(-1, -1, player->get_symbol());
+            return Move<char>(-1, -1, player->get_symbol());
         }
 
-        // Choose random move
-        int choice = rand() % empty_cells.size();
-        int row = empty_cells[choice].first;
-        int col = empty_cells[choice].second;
+        Move<char> move = moves[rand() % moves.size()];
+        int row = move.get_x();
+        int col = move.get_y();
 
         cout << "\nComputer plays at (" << row << ", " << col << ")\n";
 
-        return new Move<char>(row, col, player->get_symbol());
+        return Move<char>(row, col, player->get_symbol());
     }
 }
@@ -6,7 +6,7 @@
 #include <string>
 using namespace std;
 
-class Diamond_board : public Board<char> {
+class Diamond_board : public FixedBoard<char, 7, 7> {
 private:
     /**
      * @brief Counts all three-in-a-row sequences for a given symbol (horizontal, vertical, and diagonals)
@@ -44,7 +44,7 @@ public:
      * @param move The move containing position and symbol
      * @return true if move is valid, false otherwise
      */
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
 
     /**
      * @brief Check if player has WON
@@ -77,6 +77,13 @@ public:
      * @return true if someone got three-in-a-row or board is full
      */
     bool game_is_over(Player<char>* player) override;
+
+    /**
+     * @brief List every empty playable cell as a move
+     * @param player The player to move
+     * @param moves Buffer filled with the legal moves
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
 };
 
 class Diamond_UI : public ValidatedUI<char> {
@@ -86,7 +93,7 @@ public:
      */
     pair<int, int> display_to_matrix(int display_row, int display_col) const;
 
-    void display_board_matrix(const vector<vector<char>> &matrix) const {
+    void display_board_matrix(const BoardView<char>& matrix) const override {
         cout << "\n";
         cout << "   0   1   2   3   4   5   6\n";
         cout << " -----------------------------\n";
@@ -152,7 +159,7 @@ public:
      * @param player The player making the move
      * @return Move object with position and symbol
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 };
 
 #endif
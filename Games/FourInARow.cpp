@@ -1,5 +1,6 @@
 #include "FourInARow.h"
 #include "FourInARow_AI_Player.h"
+#include "FourInARow_MCTS_Player.h"
 #include <iostream>
 #include <cstdlib>
 
@@ -7,102 +8,60 @@ using namespace std;
 
 //--------------------------------------- FourInARow_Board Implementation
 
-FourInARow_Board::FourInARow_Board() : Board(6, 7) {
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+FourInARow_Board::FourInARow_Board() {
+    fill_cells(blank_symbol);
 }
 
-int FourInARow_Board::find_lowest_row(int col) {
-    for (int row = rows - 1; row >= 0; row--) {
-        if (board[row][col] == blank_symbol) {
-            return row;
-        }
+int FourInARow_Board::find_lowest_row(int col) const {
+    return heights[col] < rows ? rows - 1 - heights[col] : -1;
+}
+
+void FourInARow_Board::set_cell(int x, int y, const char& value) {
+    bool was_empty = board[x][y] == blank_symbol;
+    FixedBoard::set_cell(x, y, value);
+
+    uint64_t bit = uint64_t(1) << (y * (FourInARow_Position::HEIGHT + 1) + rows - 1 - x);
+    if (was_empty && value != blank_symbol) {
+        if (position.nb_moves() == 0) first_symbol = value;
+        position.play(bit);
+        heights[y]++;
+    } else if (!was_empty && value == blank_symbol) {
+        position.undo(bit);
+        heights[y]--;
+        if (position.nb_moves() == 0) first_symbol = 0;
     }
-    return -1;
 }
 
-bool FourInARow_Board::update_board(Move<char>* move) {
-    int col = move->get_y();
-    char mark = move->get_symbol();
+uint64_t FourInARow_Board::stones_of(char symbol) const {
+    if (first_symbol == 0) return 0;
+    // The first player is to move after an even number of discs
+    bool first_to_move = position.nb_moves() % 2 == 0;
+    return (symbol == first_symbol) == first_to_move ? position.get_current() : position.get_opponent();
+}
+
+bool FourInARow_Board::update_board(const Move<char>& move) {
+    int col = move.get_y();
+    char mark = move.get_symbol();
 
     if (col < 0 || col >= columns) {
-        cout << "Invalid column! Please choose between 0 and " << (columns - 1) << "\n";
+        if (!quiet) cout << "Invalid column! Please choose between 0 and " << (columns - 1) << "\n";
         return false;
     }
 
     int row = find_lowest_row(col);
 
     if (row == -1) {
-        cout << "Column " << col << " is full! Choose another column.\n";
+        if (!quiet) cout << "Column " << col << " is full! Choose another column.\n";
         return false;
     }
 
-    board[row][col] = mark;
+    set_cell(row, col, mark);
     n_moves++;
     return true;
 }
 
-bool FourInARow_Board::check_horizontal(char symbol) {
-    for (int row = 0; row < rows; row++) {
-        for (int col = 0; col <= columns - 4; col++) {
-            if (board[row][col] == symbol &&
-                board[row][col + 1] == symbol &&
-                board[row][col + 2] == symbol &&
-                board[row][col + 3] == symbol) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-bool FourInARow_Board::check_vertical(char symbol) {
-    for (int col = 0; col < columns; col++) {
-        for (int row = 0; row <= rows - 4; row++) {
-            if (board[row][col] == symbol &&
-                board[row + 1][col] == symbol &&
-                board[row + 2][col] == symbol &&
-                board[row + 3][col] == symbol) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-bool FourInARow_Board::check_diagonal(char symbol) {
-    // Diagonal (bottom-left to top-right)
-    for (int row = 3; row < rows; row++) {
-        for (int col = 0; col <= columns - 4; col++) {
-            if (board[row][col] == symbol &&
-                board[row - 1][col + 1] == symbol &&
-                board[row - 2][col + 2] == symbol &&
-                board[row - 3][col + 3] == symbol) {
-                return true;
-            }
-        }
-    }
-
-    // Diagonal (top-left to bottom-right)
-    for (int row = 0; row <= rows - 4; row++) {
-        for (int col = 0; col <= columns - 4; col++) {
-            if (board[row][col] == symbol &&
-                board[row + 1][col + 1] == symbol &&
-                board[row + 2][col + 2] == symbol &&
-                board[row + 3][col + 3] == symbol) {
-                return true;
-            }
-        }
-    }
-
-    return false;
-}
-
-bool FourInARow_Board::check_four_in_row(char symbol) {
-    return check_horizontal(symbol) ||
-           check_vertical(symbol) ||
-           check_diagonal(symbol);
+bool FourInARow_Board::check_four_in_row(char symbol) const {
+    return FourInARow_Position::alignment(stones_of(symbol));
 }
 
 bool FourInARow_Board::is_win(Player<char>* player) {
@@ -124,6 +83,21 @@ bool FourInARow_Board::game_is_over(Player<char>* player) {
            (n_moves >= rows * columns);
 }
 
+GameOutcome FourInARow_Board::outcome_after(const Move<char>& last_move) {
+    // Only the player who just moved can have completed a line
+    if (check_four_in_row(last_move.get_symbol()))
+        return GameOutcome::WIN;
+    return n_moves >= rows * columns ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void FourInARow_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    // A column is playable while it has room
+    moves.clear();
+    for (int j = 0; j < columns; j++)
+        if (heights[j] < rows)
+            moves.push_back(Move<char>(0, j, player->get_symbol()));
+}
+
 //--------------------------------------- FourInARow_UI Implementation
 
 FourInARow_UI::FourInARow_UI() : ValidatedUI<char>(
@@ -143,8 +117,10 @@ PlayerType FourInARow_UI::get_player_type_choice(string player_label, const vect
             if (choice >= 1 && choice <= (int)options.size()) {
                 cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
+                // Both AI options are PlayerType::AI; create_player() reads which one
+                use_mcts = choice == 3;
                 if (choice == 1) return PlayerType::HUMAN;
-                if (choice == 2) return PlayerType::AI;
+                if (choice == 2 || choice == 3) return PlayerType::AI;
 
                 return PlayerType::HUMAN;
             }
@@ -159,7 +135,7 @@ PlayerType FourInARow_UI::get_player_type_choice(string player_label, const vect
 
 Player<char>** FourInARow_UI::setup_players() {
     Player<char>** players = new Player<char>*[2];
-    vector<string> type_options = { "Human", "AI (Smart)" };
+    vector<string> type_options = { "Human", "AI (Smart)", "AI (Monte Carlo)" };
 
     string nameX = get_player_name("Player X");
     PlayerType typeX = get_player_type_choice("Player X", type_options);
@@ -173,7 +149,10 @@ Player<char>** FourInARow_UI::setup_players() {
 }
 
 Player<char>* FourInARow_UI::create_player(string& name, char symbol, PlayerType type) {
-    if (type == PlayerType::AI) {
+    if (type == PlayerType::AI && use_mcts) {
+        cout << "Creating Monte Carlo AI player: " << name << " (" << symbol << ")\n";
+        return new FourInARow_MCTS_Player(name, symbol);
+    } else if (type == PlayerType::AI) {
         cout << "Creating AI player: " << name << " (" << symbol << ")\n";
         return new FourInARow_AI_Player(name, symbol);
     } else {
@@ -182,7 +161,7 @@ Player<char>* FourInARow_UI::create_player(string& name, char symbol, PlayerType
     }
 }
 
-Move<char>* FourInARow_UI::get_move(Player<char>* player) {
+Move<char> FourInARow_UI::get_move(Player<char>* player) {
     int col;
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -193,14 +172,15 @@ Move<char>* FourInARow_UI::get_move(Player<char>* player) {
         );
     }
     else if (player->get_type() == PlayerType::AI) {
-        FourInARow_AI_Player* ai_player = dynamic_cast<FourInARow_AI_Player*>(player);
-
         cout << "\nAI " << player->get_name() << " is thinking...\n";
-        col = ai_player->get_best_column();
+        if (FourInARow_MCTS_Player* mcts_player = dynamic_cast<FourInARow_MCTS_Player*>(player))
+            col = mcts_player->get_best_column();
+        else
+            col = dynamic_cast<FourInARow_AI_Player*>(player)->get_best_column();
 
         cout << "AI " << player->get_name() << " (" << player->get_symbol()
              << ") plays column: " << col << endl;
     }
 
-    return new Move<char>(0, col, player->get_symbol());
+    return Move<char>(0, col, player->get_symbol());
 }
@@ -11,6 +11,7 @@
 
 #include "BoardGame_Classes.h"
 #include "ValidatedUI.h"
+#include "FourInARow_Solver.h"
 #include <string>
 
 using namespace std;
@@ -19,46 +20,49 @@ using namespace std;
  * @class FourInARow_Board
  * @brief Board class for Four-in-a-row game
  *
- * 6 rows x 7 columns grid where pieces "fall" to the bottom
+ * 6 rows x 7 columns grid where pieces "fall" to the bottom.
+ *
+ * The game state proper is a FourInARow_Position (the AI's own two-player
+ * bitboard, with the side to move's stones apart) and the height of each
+ * column; the char cells are kept in step for display. Every cell write,
+ * including undo, goes through set_cell(), which drops or lifts the disc
+ * in the bitboard, so both always agree. Turns are assumed to alternate.
  */
-class FourInARow_Board : public Board<char> {
+class FourInARow_Board : public FixedBoard<char, FourInARow_Position::HEIGHT, FourInARow_Position::WIDTH> {
 private:
-    char blank_symbol = ' '; ///< Character for empty cell
+    char blank_symbol = ' ';                 ///< Character for empty cell
+    FourInARow_Position position;             ///< Both players' discs, side to move first
+    int heights[FourInARow_Position::WIDTH] = {}; ///< Discs in each column
+    char first_symbol = 0;                    ///< Symbol of the first disc (0 on an empty board)
 
     /**
      * @brief Find the lowest available row in a column
      * @param col The column to check
      * @return Row index of lowest empty cell, or -1 if column is full
      */
-    int find_lowest_row(int col);
-
-    /**
-     * @brief Check if a player has four-in-a-row
-     * @param symbol The symbol to check
-     * @return true if four-in-a-row exists
-     */
-    bool check_four_in_row(char symbol);
+    int find_lowest_row(int col) const;
 
     /**
-     * @brief Check horizontal lines for four-in-a-row
-     * @param symbol The symbol to check
-     * @return true if found
+     * @brief Bitboard of the discs with the given symbol
      */
-    bool check_horizontal(char symbol);
+    uint64_t stones_of(char symbol) const;
 
     /**
-     * @brief Check vertical lines for four-in-a-row
+     * @brief Check if a player has four-in-a-row
+     * (horizontally, vertically or diagonally, using the bitboard)
      * @param symbol The symbol to check
-     * @return true if found
+     * @return true if four-in-a-row exists
      */
-    bool check_vertical(char symbol);
+    bool check_four_in_row(char symbol) const;
 
+protected:
     /**
-     * @brief Check diagonal lines for four-in-a-row
-     * @param symbol The symbol to check
-     * @return true if found
+     * @brief Write a cell and drop or lift the matching disc in the bitboard
+     *
+     * Cells only ever gain the disc on top of a column (a drop) or lose it
+     * (undo), so one play() or undo() keeps the position exact.
      */
-    bool check_diagonal(char symbol);
+    void set_cell(int x, int y, const char& value) override;
 
 public:
     /**
@@ -71,7 +75,7 @@ public:
      * @param move The move containing column and symbol
      * @return true if move is valid, false otherwise
      */
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
 
     /**
      * @brief Check if player has won (four-in-a-row)
@@ -100,6 +104,27 @@ public:
      * @return true if someone won or board is full
      */
     bool game_is_over(Player<char>* player) override;
+
+    /**
+     * @brief Check only the lines through the piece that just landed
+     * @param last_move The move just applied (column and symbol)
+     * @return WIN on four in a row, DRAW on a full board, else ONGOING
+     */
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+
+    /**
+     * @brief List one move per column that still has room
+     * @param player The player to move
+     * @param moves Buffer filled with moves of the form (0, column, symbol)
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
+
+    /**
+     * @brief The live bitboard position, with the player to move as "current"
+     *
+     * Read by the AI directly: no copy of the grid and no conversion.
+     */
+    const FourInARow_Position& get_position() const { return position; }
 };
 
 /**
@@ -107,6 +132,9 @@ public:
  * @brief UI class for Four-in-a-row game
  */
 class FourInARow_UI : public ValidatedUI<char> {
+private:
+    bool use_mcts = false; ///< Last AI choice was the Monte Carlo player
+
 public:
     /**
      * @brief Constructor
@@ -120,6 +148,9 @@ public:
 
     /**
      * @brief Create a player based on type (supports AI)
+     *
+     * An AI is the alpha-beta player, or the Monte Carlo player if that was
+     * the last type chosen.
      * @param name Player name
      * @param symbol Player symbol ('X' or 'O')
      * @param type Player type (HUMAN or AI)
@@ -139,7 +170,7 @@ public:
      * @param player The player making the move
      * @return Move object with column choice
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 
 protected:
     /**
@@ -6,306 +6,619 @@
 
 #include "BoardGame_Classes.h"
 #include "FourInARow.h"
-#include <vector>
+#include "FourInARow_Solver.h"
+#include "FourInARow_TT.h"
+#include "FourInARow_Book.h"
+#include "FourInARow_NNUE.h"
+#include "FourInARow_Threats.h"
 #include <limits>
 #include <algorithm>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace std;
 
 /**
- * @brief Smart AI Player for Four-in-a-Row using Minimax algorithm
+ * @brief Smart AI Player for Four-in-a-Row using principal variation search
+ *
+ * Searches a FourInARow_Position bitboard, so wins and forced blocks are a
+ * few shifts and masks. Once SOLVE_FROM_MOVE stones are down the exact
+ * solver takes over and plays perfectly, as long as it finishes within
+ * SOLVER_NODE_BUDGET nodes; otherwise the heuristic search answers.
+ *
+ * Heuristic results go into a transposition table that lives as long as
+ * the player, so positions searched for one move are reused on the next.
+ *
+ * The heuristic search is a negamax principal variation search. It
+ * deepens one ply at a time until the time budget runs out, each
+ * iteration starting from an aspiration window around the previous score,
+ * and plays the best move of the last iteration that finished. That
+ * iteration's expected line is kept (get_principal_variation()).
+ * Leaves are scored by FourInARow_NNUE, whose first layer is updated as
+ * discs are dropped and lifted during the search, plus the odd/even threat
+ * verdict of FourInARow_Threats, which also cuts closed positions that are
+ * clearly decided a few plies from the horizon.
+ *
+ * Opening positions are answered from the memory-mapped book in BOOK_FILE
+ * when it is present (build it with tools/FourInARow_BookBuilder.cpp).
+ *
+ * With more than one thread (set_threads()) the search is Lazy SMP: helper threads run
+ * the same iterative deepening, half of them one ply ahead, and share
+ * only the lock-free transposition table. What one thread stores steers
+ * and cuts the others, so the calling thread finishes its depths sooner.
  */
 class FourInARow_AI_Player : public Player<char> {
 private:
-    const int MAX_DEPTH = 6; // Search depth limit for performance
+    const int SOLVE_FROM_MOVE = 16;                            // Stones on the board before trying an exact solve
+    const unsigned long long SOLVER_NODE_BUDGET = 2000000;     // Per-move node budget of the exact solver
+    const int WIN_SCORE = 100000;                              // Heuristic score of a won position
+    static constexpr const char* BOOK_FILE = "c4book.bin";     // Opening book, next to dic.txt
+
+    static constexpr int MAX_PLY = FourInARow_Position::WIDTH * FourInARow_Position::HEIGHT;
+    static constexpr int PARITY_FROM_MOVE = 8;          // Stones before the threat parity counts in the evaluation
+    static constexpr int PARITY_SCORE_PER_STONE = 100;  // Weight of the parity verdict per stone past that
+    static constexpr int THREAT_PRUNE_DEPTH = 3;        // Deepest remaining depth a parity verdict may cut
+    static constexpr int THREAT_PRUNE_FROM_MOVE = 18;   // Stones before parity verdicts may cut
+    static constexpr int THREAT_PRUNE_MARGIN = 500;     // Score past the window needed per ply of depth cut
+    static constexpr int ASPIRATION_WINDOW = 250;       // Half-width of the first root window around the last score
+    static constexpr int INFINITE_SCORE = 1000000;      // Above any reachable score, safe to negate
 
     /**
-     * @brief Find the lowest available row in a column
+     * @brief Search state owned by one thread
+     *
+     * Aligned to a cache line so threads updating their own counters and
+     * tables never write to a line another thread is using.
      */
-    int find_lowest_row(vector<vector<char>>& board, int col) {
-        for (int row = 5; row >= 0; row--) {
-            if (board[row][col] == ' ') {
-                return row;
-            }
+    struct alignas(64) SearchThread {
+        int killers[MAX_PLY + 1][2];   // Two latest cutoff columns per ply
+        int history[2][64] = {};       // Cutoff credit per side (AI = 0) and cell bit
+        int root_depth = 0;            // Depth of the current iteration, to turn depth into ply
+        bool checks_clock = false;     // Only the calling thread watches the deadline
+        unsigned long long nodes = 0;              // Nodes visited this move
+        unsigned long long cutoffs = 0;            // Beta cutoffs this move
+        unsigned long long first_move_cutoffs = 0; // ... of which on the first move tried
+        int completed_depth = 0;       // Depth of the last finished iteration
+        int best_col = -1;             // Best column of that iteration
+        int completed_score = 0;       // Its score for the AI
+        int pv[MAX_PLY + 1][MAX_PLY + 1];  // Principal variation from each ply (triangular)
+        int pv_length[MAX_PLY + 2];        // End of the line stored at each ply
+        int completed_pv[MAX_PLY];         // Principal variation of the last finished iteration
+        int completed_pv_length = 0;
+        FourInARow_NNUE::Accumulator acc;  // Evaluator state of the searched position, AI = side 0
+
+        SearchThread() {
+            for (auto& k : killers) k[0] = k[1] = -1;
         }
-        return -1;
+
+        /**
+         * @brief Reset for a new move: killers and counters restart, history fades
+         */
+        void new_search() {
+            for (auto& k : killers) k[0] = k[1] = -1;
+            for (auto& side : history)
+                for (int& h : side) h /= 2;
+            nodes = cutoffs = first_move_cutoffs = 0;
+            completed_depth = 0;
+            best_col = -1;
+            completed_score = 0;
+            completed_pv_length = 0;
+        }
+    };
+
+    FourInARow_TT tt;              // Search results, kept for the whole game and shared by all threads
+    vector<SearchThread> threads;  // threads[0] is the calling thread
+    int time_budget_ms = 300;      // Thinking time per move
+    int depth_limit = 0;           // Deepest iteration to run (0 = no limit)
+    int completed_depth = 0;       // Depth of the result played by the last move
+    int completed_score = 0;       // Its score for the AI
+    vector<int> principal_variation; // Its expected line, AI's column first
+    unsigned long long solver_nodes = 0; // Nodes the exact solver spent on the last move
+    bool use_book = true;          // Consult the opening book before searching
+
+    chrono::steady_clock::time_point deadline; // When the current move must be ready
+    atomic<bool> stopped{false};   // Set once every thread must unwind
+
+    /**
+     * @brief Check the clock every 1024 nodes and flag the search to stop
+     */
+    bool out_of_time(SearchThread& t) {
+        if (t.checks_clock && (t.nodes & 1023) == 0 && chrono::steady_clock::now() >= deadline)
+            stopped.store(true, memory_order_relaxed);
+        return stopped.load(memory_order_relaxed);
     }
 
     /**
-     * @brief Check if there are four in a row for given symbol
+     * @brief Point the evaluator at a root position with the AI to move
      */
-    bool check_four_in_row(vector<vector<char>>& board, char sym) {
-        // Horizontal
-        for (int row = 0; row < 6; row++) {
-            for (int col = 0; col <= 3; col++) {
-                if (board[row][col] == sym &&
-                    board[row][col + 1] == sym &&
-                    board[row][col + 2] == sym &&
-                    board[row][col + 3] == sym) {
-                    return true;
-                }
-            }
-        }
+    static void load_position(SearchThread& t, const FourInARow_Position& pos) {
+        FourInARow_NNUE::refresh(t.acc, pos.get_current(), pos.get_opponent());
+    }
 
-        // Vertical
-        for (int col = 0; col < 7; col++) {
-            for (int row = 0; row <= 2; row++) {
-                if (board[row][col] == sym &&
-                    board[row + 1][col] == sym &&
-                    board[row + 2][col] == sym &&
-                    board[row + 3][col] == sym) {
-                    return true;
-                }
-            }
-        }
+    /**
+     * @brief Static score for side (AI = 0), who is to move: network plus threat parity
+     *
+     * The parity verdict gets more reliable as the board fills, so its
+     * weight grows with the stone count.
+     */
+    static int static_eval(const SearchThread& t, const FourInARow_Position& pos, int side,
+                           const FourInARow_Threats::Report& threats) {
+        int eval = FourInARow_NNUE::evaluate(t.acc, side);
+        if (pos.nb_moves() > PARITY_FROM_MOVE)
+            eval += threats.verdict * PARITY_SCORE_PER_STONE * (pos.nb_moves() - PARITY_FROM_MOVE);
+        return eval;
+    }
+
+    /**
+     * @brief Column of a single-bit move
+     */
+    static int column_of(uint64_t move) {
+        return __builtin_ctzll(move) / (FourInARow_Position::HEIGHT + 1);
+    }
 
-        // Diagonal (bottom-left to top-right)
-        for (int row = 3; row < 6; row++) {
-            for (int col = 0; col <= 3; col++) {
-                if (board[row][col] == sym &&
-                    board[row - 1][col + 1] == sym &&
-                    board[row - 2][col + 2] == sym &&
-                    board[row - 3][col + 3] == sym) {
-                    return true;
-                }
+    /**
+     * @brief Make a win score relative to the node storing it
+     *
+     * Win scores count the depth left when the win happens; the table keeps
+     * the distance from the node instead, so a hit is valid at any depth.
+     */
+    int score_to_tt(int score, int depth) const {
+        if (score > WIN_SCORE / 2) return score - depth;
+        if (score < -WIN_SCORE / 2) return score + depth;
+        return score;
+    }
+
+    /**
+     * @brief Inverse of score_to_tt() for a node with the given depth left
+     */
+    int score_from_tt(int score, int depth) const {
+        if (score > WIN_SCORE / 2) return score + depth;
+        if (score < -WIN_SCORE / 2) return score - depth;
+        return score;
+    }
+
+    /**
+     * @brief List the columns in next, best candidates first
+     *
+     * Order: the table's (or previous iteration's) best column, the two
+     * killer columns of this ply, then the rest by history score, with
+     * center-out order breaking ties.
+     * @return Number of columns written to order
+     */
+    static int order_columns(const SearchThread& t, uint64_t next, int tt_col, int ply, int side, int order[]) {
+        static const int CENTER_OUT[FourInARow_Position::WIDTH] = { 3, 2, 4, 1, 5, 0, 6 };
+        int count = 0;
+        uint64_t remaining = next;
+
+        int preferred[3] = { tt_col, t.killers[ply][0], t.killers[ply][1] };
+        for (int col : preferred) {
+            if (col >= 0 && (remaining & FourInARow_Position::column_mask(col))) {
+                order[count++] = col;
+                remaining &= ~FourInARow_Position::column_mask(col);
             }
         }
 
-        // Diagonal (top-left to bottom-right)
-        for (int row = 0; row <= 2; row++) {
-            for (int col = 0; col <= 3; col++) {
-                if (board[row][col] == sym &&
-                    board[row + 1][col + 1] == sym &&
-                    board[row + 2][col + 2] == sym &&
-                    board[row + 3][col + 3] == sym) {
-                    return true;
-                }
+        // Insertion sort keeps center-out order among equal history scores
+        int first_sorted = count;
+        for (int col : CENTER_OUT) {
+            uint64_t move = remaining & FourInARow_Position::column_mask(col);
+            if (!move) continue;
+            int score = t.history[side][__builtin_ctzll(move)];
+            int j = count++;
+            for (; j > first_sorted; j--) {
+                uint64_t prev = next & FourInARow_Position::column_mask(order[j - 1]);
+                if (t.history[side][__builtin_ctzll(prev)] >= score) break;
+                order[j] = order[j - 1];
             }
+            order[j] = col;
         }
-
-        return false;
+        return count;
     }
 
     /**
-     * @brief Evaluate board position (heuristic)
+     * @brief Remember the move that caused a beta cutoff
      */
-    int evaluate_position(vector<vector<char>>& board, char ai_sym, char opp_sym) {
-        // Check terminal states first
-        if (check_four_in_row(board, ai_sym)) return 100000;
-        if (check_four_in_row(board, opp_sym)) return -100000;
+    static void record_cutoff(SearchThread& t, uint64_t move, int col, int ply, int side, int depth, bool first) {
+        t.cutoffs++;
+        if (first) t.first_move_cutoffs++;
 
-        int score = 0;
-
-        // Evaluate all windows of 4
-        // Horizontal
-        for (int row = 0; row < 6; row++) {
-            for (int col = 0; col <= 3; col++) {
-                int ai_count = 0, opp_count = 0, empty = 0;
-                for (int i = 0; i < 4; i++) {
-                    if (board[row][col + i] == ai_sym) ai_count++;
-                    else if (board[row][col + i] == opp_sym) opp_count++;
-                    else empty++;
-                }
-                score += evaluate_window(ai_count, opp_count, empty);
-            }
+        if (t.killers[ply][0] != col) {
+            t.killers[ply][1] = t.killers[ply][0];
+            t.killers[ply][0] = col;
         }
+        t.history[side][__builtin_ctzll(move)] += depth * depth;
+    }
 
-        // Vertical
-        for (int col = 0; col < 7; col++) {
-            for (int row = 0; row <= 2; row++) {
-                int ai_count = 0, opp_count = 0, empty = 0;
-                for (int i = 0; i < 4; i++) {
-                    if (board[row + i][col] == ai_sym) ai_count++;
-                    else if (board[row + i][col] == opp_sym) opp_count++;
-                    else empty++;
-                }
-                score += evaluate_window(ai_count, opp_count, empty);
+    /**
+     * @brief Negamax principal variation search
+     *
+     * Scores are for the side to move (side, AI = 0). The first move gets
+     * the full window; the rest are scouted with a null window and only
+     * searched again if the scout lands inside (alpha, beta). Fail-soft, so
+     * scores outside the window are still bounds the caller can use.
+     *
+     * Children are bitboard copies, so nothing is undone and nothing is
+     * allocated. Wins score higher the more depth is left (sooner is better).
+     * Results are stored in the transposition table with their bound type;
+     * table cutoffs are only taken at null-window nodes, so the principal
+     * variation is never cut short by one. Once out of time it unwinds at
+     * once, returning 0 and storing nothing.
+     */
+    int negamax(SearchThread& t, const FourInARow_Position& pos, int depth, int alpha, int beta, int side) {
+        int ply = t.root_depth - depth;
+        t.pv_length[ply] = ply;
+        t.nodes++;
+        if (out_of_time(t)) return 0;
+
+        // Terminal states: the side to move wins now, the board is full,
+        // or every move hands the opponent a win
+        if (pos.can_win_next()) return WIN_SCORE + depth;
+        if (pos.possible() == 0) return 0; // Draw
+        uint64_t next = pos.possible_non_losing_moves();
+        if (next == 0) return -WIN_SCORE - (depth - 1);
+        if (depth == 0) // Leaf: the running accumulator plus threat parity
+            return static_eval(t, pos, side, FourInARow_Threats::analyze(pos));
+
+        // Near the end of a line, a closed position whose parity verdict is
+        // well past the window is settled without searching it. Positions
+        // with a threat to block are left to the search.
+        if (depth <= THREAT_PRUNE_DEPTH && pos.nb_moves() >= THREAT_PRUNE_FROM_MOVE) {
+            FourInARow_Threats::Report threats = FourInARow_Threats::analyze(pos);
+            if (threats.verdict != 0 && !threats.playable[1]) {
+                int score = static_eval(t, pos, side, threats);
+                int margin = THREAT_PRUNE_MARGIN * depth;
+                if (threats.verdict > 0 ? score >= beta + margin : score <= alpha - margin) return score;
             }
         }
 
-        // Diagonal (bottom-left to top-right)
-        for (int row = 3; row < 6; row++) {
-            for (int col = 0; col <= 3; col++) {
-                int ai_count = 0, opp_count = 0, empty = 0;
-                for (int i = 0; i < 4; i++) {
-                    if (board[row - i][col + i] == ai_sym) ai_count++;
-                    else if (board[row - i][col + i] == opp_sym) opp_count++;
-                    else empty++;
-                }
-                score += evaluate_window(ai_count, opp_count, empty);
+        // Reuse an earlier search of this position (or its mirror image)
+        bool pv_node = beta - alpha > 1;
+        FourInARow_TT::Entry entry;
+        int tt_col = -1;
+        if (tt.probe(pos, entry)) {
+            tt_col = entry.best_col;
+            if (!pv_node && entry.depth >= depth) {
+                int stored = score_from_tt(entry.score, depth);
+                if (entry.bound == FourInARow_TT::EXACT) return stored;
+                if (entry.bound == FourInARow_TT::LOWER ? stored >= beta : stored <= alpha) return stored;
             }
         }
-
-        // Diagonal (top-left to bottom-right)
-        for (int row = 0; row <= 2; row++) {
-            for (int col = 0; col <= 3; col++) {
-                int ai_count = 0, opp_count = 0, empty = 0;
-                for (int i = 0; i < 4; i++) {
-                    if (board[row + i][col + i] == ai_sym) ai_count++;
-                    else if (board[row + i][col + i] == opp_sym) opp_count++;
-                    else empty++;
-                }
-                score += evaluate_window(ai_count, opp_count, empty);
+        const int window_alpha = alpha;
+
+        int order[FourInARow_Position::WIDTH];
+        int count = order_columns(t, next, tt_col, ply, side, order);
+        int best_col = order[0];
+        int best_score = -INFINITE_SCORE;
+
+        for (int i = 0; i < count; i++) {
+            uint64_t move = next & FourInARow_Position::column_mask(order[i]);
+            FourInARow_Position child = pos;
+            child.play(move);
+            FourInARow_NNUE::add(t.acc, __builtin_ctzll(move), side);
+            int score;
+            if (i == 0) {
+                score = -negamax(t, child, depth - 1, -beta, -alpha, side ^ 1);
+            } else {
+                score = -negamax(t, child, depth - 1, -alpha - 1, -alpha, side ^ 1);
+                if (score > alpha && score < beta)
+                    score = -negamax(t, child, depth - 1, -beta, -alpha, side ^ 1);
             }
-        }
+            FourInARow_NNUE::remove(t.acc, __builtin_ctzll(move), side);
+            if (stopped.load(memory_order_relaxed)) return 0;
 
-        // Center column preference
-        for (int row = 0; row < 6; row++) {
-            if (board[row][3] == ai_sym) score += 5;
+            if (score > best_score) {
+                best_score = score;
+                best_col = order[i];
+            }
+            if (score > alpha) {
+                alpha = score;
+                update_pv(t, ply, order[i]);
+            }
+            if (alpha >= beta) {
+                record_cutoff(t, move, order[i], ply, side, depth, i == 0);
+                break;
+            }
         }
 
-        return score;
+        FourInARow_TT::Bound bound = best_score <= window_alpha ? FourInARow_TT::UPPER
+                                   : best_score >= beta ? FourInARow_TT::LOWER
+                                   : FourInARow_TT::EXACT;
+        tt.store(pos, score_to_tt(best_score, depth), depth, bound, best_col);
+        return best_score;
     }
 
     /**
-     * @brief Evaluate a window of 4 cells
+     * @brief Make col followed by the child's line the principal variation at ply
      */
-    int evaluate_window(int ai_count, int opp_count, int empty) {
-        if (ai_count == 4) return 10000;
-        if (opp_count == 4) return -10000;
+    static void update_pv(SearchThread& t, int ply, int col) {
+        t.pv[ply][ply] = col;
+        for (int i = ply + 1; i < t.pv_length[ply + 1]; i++) t.pv[ply][i] = t.pv[ply + 1][i];
+        t.pv_length[ply] = max(t.pv_length[ply + 1], ply + 1);
+    }
 
-        if (ai_count == 3 && empty == 1) return 500;
-        if (ai_count == 2 && empty == 2) return 50;
+    /**
+     * @brief One iteration of the root search to the given depth, inside (alpha, beta)
+     * @param pos Root position (AI to move)
+     * @param next Root moves that don't lose at once
+     * @param depth Depth to search
+     * @param first Column to try first (the previous iteration's best)
+     * @param best_col Set to the best column found
+     * @return Fail-soft score of best_col; meaningless if the search was stopped
+     */
+    int search_root(SearchThread& t, const FourInARow_Position& pos, uint64_t next, int depth,
+                    int alpha, int beta, int first, int& best_col) {
+        t.root_depth = depth;
+        t.pv_length[0] = 0;
+        const int window_alpha = alpha;
+        int best_score = -INFINITE_SCORE;
+
+        // Try each column that doesn't lose at once, best one so far first
+        int order[FourInARow_Position::WIDTH];
+        int count = order_columns(t, next, first, 0, 0, order);
+        best_col = order[0];
+
+        load_position(t, pos);
+        for (int i = 0; i < count; i++) {
+            int col = order[i];
+            uint64_t move = next & FourInARow_Position::column_mask(col);
+            FourInARow_Position child = pos;
+            child.play(move);
+            FourInARow_NNUE::add(t.acc, __builtin_ctzll(move), 0);
+            int score;
+            if (i == 0) {
+                score = -negamax(t, child, depth - 1, -beta, -alpha, 1);
+            } else {
+                score = -negamax(t, child, depth - 1, -alpha - 1, -alpha, 1);
+                if (score > alpha && score < beta)
+                    score = -negamax(t, child, depth - 1, -beta, -alpha, 1);
+            }
+            FourInARow_NNUE::remove(t.acc, __builtin_ctzll(move), 0);
+            if (stopped.load(memory_order_relaxed)) return 0;
 
-        if (opp_count == 3 && empty == 1) return -400;
-        if (opp_count == 2 && empty == 2) return -40;
+            if (score > best_score) {
+                best_score = score;
+                best_col = col;
+            }
+            if (score > alpha) {
+                alpha = score;
+                update_pv(t, 0, col);
+            }
+            if (alpha >= beta) break;
+        }
 
-        return 0;
+        FourInARow_TT::Bound bound = best_score <= window_alpha ? FourInARow_TT::UPPER
+                                   : best_score >= beta ? FourInARow_TT::LOWER
+                                   : FourInARow_TT::EXACT;
+        tt.store(pos, score_to_tt(best_score, depth), depth, bound, best_col);
+        return best_score;
     }
 
     /**
-     * @brief Get valid columns
+     * @brief Iterative deepening for one thread until it is told to stop
+     *
+     * From the second iteration on, the root window is centred on the
+     * previous score. A result outside it widens that side of the window
+     * (doubling each time, then fully open) and searches the depth again.
+     * @param t The thread's own state
+     * @param pos Root position (AI to move)
+     * @param next Root moves that don't lose at once
+     * @param start_depth First depth to search (helpers may start deeper)
+     * @param max_depth Last depth to search
      */
-    vector<int> get_valid_columns(vector<vector<char>>& board) {
-        vector<int> valid;
-        for (int c = 0; c < 7; c++) {
-            if (board[0][c] == ' ') {
-                valid.push_back(c);
+    void iterate(SearchThread& t, const FourInARow_Position& pos, uint64_t next,
+                 int start_depth, int max_depth) {
+        int best_col = column_of(next & -next);
+        int score = 0;
+        int scores[MAX_PLY + 1]; // Score of each finished depth
+        for (int depth = start_depth; depth <= max_depth; depth++) {
+            // Scores swing with the parity of the horizon, so aim at the
+            // iteration two plies back
+            int delta = ASPIRATION_WINDOW;
+            int guess = depth - 2 >= start_depth ? scores[depth - 2] : 0;
+            bool aspire = depth - 2 >= start_depth && guess > -WIN_SCORE / 2 && guess < WIN_SCORE / 2;
+            int alpha = aspire ? guess - delta : -INFINITE_SCORE;
+            int beta = aspire ? guess + delta : INFINITE_SCORE;
+
+            int col;
+            while (true) {
+                score = search_root(t, pos, next, depth, alpha, beta, best_col, col);
+                if (stopped.load(memory_order_relaxed)) return;
+                if (score > alpha && score < beta) break;
+
+                delta *= 2;
+                bool wide = delta > WIN_SCORE / 2;
+                if (score <= alpha) alpha = wide ? -INFINITE_SCORE : max(score - delta, -INFINITE_SCORE);
+                else beta = wide ? INFINITE_SCORE : min(score + delta, INFINITE_SCORE);
             }
+
+            scores[depth] = score;
+            best_col = col;
+            t.best_col = col;
+            t.completed_depth = depth;
+            t.completed_score = score;
+            t.completed_pv_length = t.pv_length[0];
+            for (int i = 0; i < t.pv_length[0]; i++) t.completed_pv[i] = t.pv[0][i];
+            if (score > WIN_SCORE / 2 || score < -WIN_SCORE / 2) break;
+
+            // The first iteration always finishes, so there is a move to play
+            t.checks_clock = &t == &threads[0];
         }
-        return valid;
     }
 
     /**
-     * @brief Minimax algorithm with alpha-beta pruning
+     * @brief The opening book, mapped once and shared by every AI player
      */
-    int minimax(vector<vector<char>>& board, int depth, bool is_maximizing,
-                int alpha, int beta, char ai_sym, char opp_sym) {
-
-        vector<int> valid_cols = get_valid_columns(board);
-
-        // Terminal states
-        if (check_four_in_row(board, ai_sym)) return 100000 - depth;
-        if (check_four_in_row(board, opp_sym)) return -100000 + depth;
-        if (valid_cols.empty()) return 0; // Draw
-        if (depth == 0) return evaluate_position(board, ai_sym, opp_sym);
-
-        if (is_maximizing) {
-            int max_eval = numeric_limits<int>::min();
-
-            for (int col : valid_cols) {
-                int row = find_lowest_row(board, col);
-                if (row != -1) {
-                    board[row][col] = ai_sym;
+    static const FourInARow_Book& opening_book() {
+        static FourInARow_Book book;
+        static const bool opened = book.open(BOOK_FILE);
+        (void)opened; // A missing book just means every move is searched
+        return book;
+    }
 
-                    int eval = minimax(board, depth - 1, false, alpha, beta, ai_sym, opp_sym);
+public:
+    /**
+     * @brief Constructor for AI player
+     */
+    FourInARow_AI_Player(string name, char symbol)
+        : Player<char>(name, symbol, PlayerType::AI) {
+        set_threads(1); // Helper threads are opt-in through set_threads()
+        opening_book(); // Map the book now rather than on the first move
+    }
 
-                    board[row][col] = ' ';
+    /**
+     * @brief Turn opening book lookups on or off (the book builder turns them off)
+     */
+    void set_use_book(bool value) { use_book = value; }
 
-                    max_eval = max(max_eval, eval);
-                    alpha = max(alpha, eval);
+    /**
+     * @brief Forget everything learnt from earlier moves (transposition table,
+     * killers, history), as for a fresh player
+     */
+    void new_game() {
+        tt.clear();
+        threads = vector<SearchThread>(threads.size());
+    }
 
-                    if (beta <= alpha) break; // Alpha-beta pruning
-                }
-            }
-            return max_eval;
-        } else {
-            int min_eval = numeric_limits<int>::max();
+    /**
+     * @brief Set how many threads search each move (1 = no helpers)
+     */
+    void set_threads(int count) { threads = vector<SearchThread>(max(count, 1)); }
 
-            for (int col : valid_cols) {
-                int row = find_lowest_row(board, col);
-                if (row != -1) {
-                    board[row][col] = opp_sym;
+    /**
+     * @brief Number of search threads
+     */
+    int get_threads() const { return (int)threads.size(); }
 
-                    int eval = minimax(board, depth - 1, true, alpha, beta, ai_sym, opp_sym);
+    /**
+     * @brief Nodes visited by the last get_best_column() call, all threads and the solver together
+     */
+    unsigned long long get_nodes() const {
+        unsigned long long total = solver_nodes;
+        for (const SearchThread& t : threads) total += t.nodes;
+        return total;
+    }
 
-                    board[row][col] = ' ';
+    /**
+     * @brief Set the thinking time per move
+     */
+    void set_time_budget(int milliseconds) { time_budget_ms = milliseconds; }
 
-                    min_eval = min(min_eval, eval);
-                    beta = min(beta, eval);
+    /**
+     * @brief Cap the iteration depth (0 removes the cap)
+     */
+    void set_depth_limit(int depth) { depth_limit = depth; }
 
-                    if (beta <= alpha) break; // Alpha-beta pruning
-                }
-            }
-            return min_eval;
-        }
+    /**
+     * @brief Beta cutoffs in the last get_best_column() call
+     */
+    unsigned long long get_cutoffs() const {
+        unsigned long long total = 0;
+        for (const SearchThread& t : threads) total += t.cutoffs;
+        return total;
     }
 
-public:
     /**
-     * @brief Constructor for AI player
+     * @brief Percentage of the last call's cutoffs that came from the first move tried
      */
-    FourInARow_AI_Player(string name, char symbol)
-        : Player<char>(name, symbol, PlayerType::AI) {}
+    double get_first_move_cutoff_rate() const {
+        unsigned long long first = 0;
+        for (const SearchThread& t : threads) first += t.first_move_cutoffs;
+        unsigned long long total = get_cutoffs();
+        return total ? 100.0 * first / total : 0.0;
+    }
 
     /**
-     * @brief Get best move using minimax algorithm
+     * @brief Depth of the last iteration finished by get_best_column()
      */
-    int get_best_column() {
-        vector<vector<char>> board = boardPtr->get_board_matrix();
-        vector<int> valid_cols = get_valid_columns(board);
-
-        if (valid_cols.empty()) return 3;
-
-        char ai_sym = symbol;
-        char opp_sym = (symbol == 'X') ? 'O' : 'X';
-
-        // Check for immediate win or block
-        for (int col : valid_cols) {
-            int row = find_lowest_row(board, col);
-            if (row != -1) {
-                // Check if this move wins
-                board[row][col] = ai_sym;
-                if (check_four_in_row(board, ai_sym)) {
-                    board[row][col] = ' ';
-                    return col;
-                }
-                board[row][col] = ' ';
-
-                // Check if we need to block
-                board[row][col] = opp_sym;
-                if (check_four_in_row(board, opp_sym)) {
-                    board[row][col] = ' ';
-                    return col;
-                }
-                board[row][col] = ' ';
-            }
-        }
-
-        int best_col = valid_cols[0];
-        int best_score = numeric_limits<int>::min();
+    int get_completed_depth() const { return completed_depth; }
 
-        int alpha = numeric_limits<int>::min();
-        int beta = numeric_limits<int>::max();
+    /**
+     * @brief Search score (for the AI) of the last move; 0 if it was not searched
+     */
+    int get_score() const { return completed_score; }
 
-        // Try each valid column
-        for (int col : valid_cols) {
-            int row = find_lowest_row(board, col);
-            if (row != -1) {
-                board[row][col] = ai_sym;
+    /**
+     * @brief Expected line of the last move as columns, starting with the AI's
+     *
+     * Empty when the move came from the book, the solver or a forced reply.
+     */
+    const vector<int>& get_principal_variation() const { return principal_variation; }
 
-                int score = minimax(board, MAX_DEPTH - 1, false, alpha, beta, ai_sym, opp_sym);
+    /**
+     * @brief Get best move: exact when affordable, principal variation search otherwise
+     */
+    int get_best_column() {
+        // A FourInARow_Board already holds the bitboard, with the AI to move
+        if (const FourInARow_Board* board = dynamic_cast<const FourInARow_Board*>(boardPtr))
+            return get_best_column(board->get_position());
+        return get_best_column(FourInARow_Position::from_view(boardPtr->get_board_view(), symbol));
+    }
 
-                board[row][col] = ' ';
+    /**
+     * @brief Get best move for a position with the AI to move, without a board
+     */
+    int get_best_column(const FourInARow_Position& pos) {
+        for (SearchThread& t : threads) t.new_search();
+        completed_depth = 0;
+        completed_score = 0;
+        principal_variation.clear();
+        solver_nodes = 0;
+        deadline = chrono::steady_clock::now() + chrono::milliseconds(time_budget_ms);
+        uint64_t possible = pos.possible();
+
+        if (possible == 0) return 3;
+
+        // Check for immediate win
+        for (int col = 0; col < FourInARow_Position::WIDTH; col++) {
+            if (pos.is_winning_move(col)) return col;
+        }
 
-                if (score > best_score) {
-                    best_score = score;
-                    best_col = col;
-                }
+        // Block a single threat; if there are two, the game is lost anyway
+        uint64_t next = pos.possible_non_losing_moves();
+        if (next == 0) return column_of(possible & -possible);
+        if ((next & (next - 1)) == 0) return column_of(next);
+
+        // Known opening
+        int book_col, book_score;
+        if (use_book && opening_book().lookup(pos, book_col, book_score) && pos.can_play(book_col))
+            return book_col;
+
+        // Late enough in the game to play perfectly
+        if (pos.nb_moves() >= SOLVE_FROM_MOVE) {
+            FourInARow_Solver solver(SOLVER_NODE_BUDGET);
+            int col, score;
+            bool solved = solver.best_column(pos, col, score);
+            solver_nodes = solver.get_nodes();
+            if (solved) return col;
+        }
 
-                alpha = max(alpha, score);
-            }
+        // Deepen until time runs out or the result is a proven win or loss
+        int max_depth = FourInARow_Position::WIDTH * FourInARow_Position::HEIGHT - pos.nb_moves();
+        if (depth_limit > 0) max_depth = min(max_depth, depth_limit);
+        stopped.store(false);
+        for (SearchThread& t : threads) t.checks_clock = false;
+
+        // Helpers run alongside; odd ones stay a ply ahead to spread the work
+        vector<thread> helpers;
+        for (size_t i = 1; i < threads.size(); i++) {
+            int start = min(1 + (int)(i % 2), max_depth);
+            helpers.emplace_back(&FourInARow_AI_Player::iterate, this,
+                                 ref(threads[i]), cref(pos), next, start, max_depth);
+        }
+        iterate(threads[0], pos, next, 1, max_depth);
+        stopped.store(true);
+        for (thread& h : helpers) h.join();
+
+        // Play the deepest finished iteration; the calling thread wins ties
+        const SearchThread* best = &threads[0];
+        for (const SearchThread& t : threads) {
+            if (t.completed_depth > best->completed_depth) best = &t;
         }
+        completed_depth = best->completed_depth;
+        completed_score = best->completed_score;
+        principal_variation.assign(best->completed_pv, best->completed_pv + best->completed_pv_length);
+        int best_col = best->best_col >= 0 ? best->best_col : column_of(next & -next);
 
         return best_col;
     }
@@ -0,0 +1,185 @@
+// FourInARow_Book.h
+// Memory-mapped opening book for the Four-in-a-Row AI
+
+#ifndef FOUR_IN_A_ROW_BOOK_H
+#define FOUR_IN_A_ROW_BOOK_H
+
+#include "FourInARow_Solver.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Read-only opening book mapped straight from disk.
+ *
+ * File layout (little-endian, no padding):
+ * - 8-byte magic "C4BOOK01"
+ * - 8-byte entry count
+ * - that many 64-bit entries, sorted ascending
+ *
+ * Each entry packs key << 12 | column << 8 | (uint8_t)score. The key is
+ * the canonical (mirror-minimal) position key, so sorting entries sorts
+ * keys, and the column is stored in the canonical orientation. The score
+ * is exact when known (solver convention: positive means the side to move
+ * wins), or UNKNOWN_SCORE when the column came from a heuristic search.
+ *
+ * open() maps the file and checks the header; nothing is parsed or copied,
+ * and lookup() is a binary search over the mapped entries.
+ */
+class FourInARow_Book {
+public:
+    static const int UNKNOWN_SCORE = -128; ///< Score of entries that were searched, not solved
+
+private:
+    static constexpr char MAGIC[9] = "C4BOOK01";
+    static const size_t HEADER_SIZE = 16;
+
+    const uint64_t* entries = nullptr; ///< First entry, inside the mapping
+    uint64_t count = 0;                ///< Number of entries
+    void* map = nullptr;               ///< Start of the mapping
+    size_t map_size = 0;               ///< Bytes mapped
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+
+    /** @brief Point entries at the mapped data if the header is valid. */
+    bool attach() {
+        if (map_size < HEADER_SIZE || memcmp(map, MAGIC, 8) != 0) return false;
+        uint64_t n;
+        memcpy(&n, static_cast<const char*>(map) + 8, sizeof(n));
+        if (n > (map_size - HEADER_SIZE) / sizeof(uint64_t)) return false;
+        entries = reinterpret_cast<const uint64_t*>(static_cast<const char*>(map) + HEADER_SIZE);
+        count = n;
+        return true;
+    }
+
+public:
+    FourInARow_Book() = default;
+    FourInARow_Book(const FourInARow_Book&) = delete;
+    FourInARow_Book& operator=(const FourInARow_Book&) = delete;
+    ~FourInARow_Book() { close(); }
+
+    /**
+     * @brief Pack one book entry.
+     * @param pos Position the entry is for
+     * @param col Best column in pos's own orientation
+     * @param score Exact score, or UNKNOWN_SCORE
+     */
+    static uint64_t make_entry(const FourInARow_Position& pos, int col, int score) {
+        bool mirrored;
+        uint64_t key = pos.canonical_key(mirrored);
+        if (mirrored) col = FourInARow_Position::WIDTH - 1 - col;
+        return key << 12 | uint64_t(col) << 8 | uint8_t(int8_t(score));
+    }
+
+    /**
+     * @brief Write entries (any order, no duplicate positions) as a book file.
+     * @return false if the file could not be written
+     */
+    static bool write(const string& path, vector<uint64_t> sorted) {
+        sort(sorted.begin(), sorted.end());
+        FILE* out = fopen(path.c_str(), "wb");
+        if (!out) return false;
+        uint64_t n = sorted.size();
+        bool ok = fwrite(MAGIC, 1, 8, out) == 8 &&
+                  fwrite(&n, sizeof(n), 1, out) == 1 &&
+                  fwrite(sorted.data(), sizeof(uint64_t), n, out) == n;
+        return fclose(out) == 0 && ok;
+    }
+
+    /**
+     * @brief Map a book file, replacing any book already open.
+     * @return false if the file is missing or not a book
+     */
+    bool open(const string& path) {
+        close();
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) { close(); return false; }
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) { close(); return false; }
+        map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        map_size = (size_t)size.QuadPart;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) { ::close(fd); return false; }
+        map_size = (size_t)st.st_size;
+        map = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping keeps the file alive
+        if (map == MAP_FAILED) map = nullptr;
+#endif
+        if (!map || !attach()) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    /** @brief Unmap the book; lookups then miss. */
+    void close() {
+#ifdef _WIN32
+        if (map) UnmapViewOfFile(map);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (map) munmap(map, map_size);
+#endif
+        map = nullptr;
+        map_size = 0;
+        entries = nullptr;
+        count = 0;
+    }
+
+    /** @brief Number of positions in the book. */
+    uint64_t size() const { return count; }
+
+    /**
+     * @brief Find pos (or its mirror image) in the book.
+     * @param pos Position to look up
+     * @param col Set to the book column in pos's own orientation
+     * @param score Set to the stored score (or UNKNOWN_SCORE)
+     * @return true if the position is in the book
+     */
+    bool lookup(const FourInARow_Position& pos, int& col, int& score) const {
+        bool mirrored;
+        uint64_t key = pos.canonical_key(mirrored);
+
+        uint64_t lo = 0, hi = count;
+        while (lo < hi) {
+            uint64_t mid = lo + (hi - lo) / 2;
+            if ((entries[mid] >> 12) < key) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo == count || (entries[lo] >> 12) != key) return false;
+
+        col = int(entries[lo] >> 8 & 0xF);
+        if (mirrored) col = FourInARow_Position::WIDTH - 1 - col;
+        score = int8_t(entries[lo] & 0xFF);
+        return true;
+    }
+};
+
+#endif // FOUR_IN_A_ROW_BOOK_H
@@ -0,0 +1,325 @@
+// FourInARow_MCTS_Player.h
+// Monte Carlo Tree Search player for Four-in-a-Row (UCT with bitboard rollouts)
+
+#ifndef FOUR_IN_A_ROW_MCTS_PLAYER_H
+#define FOUR_IN_A_ROW_MCTS_PLAYER_H
+
+#include "BoardGame_Classes.h"
+#include "FourInARow.h"
+#include "FourInARow_Solver.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Four-in-a-Row player using Monte Carlo Tree Search
+ *
+ * Each iteration walks down the tree by UCT, expands the leaf it reaches,
+ * plays the game out at random on a FourInARow_Position and credits the
+ * result to every node on the way back. The move played is the root
+ * child visited most often.
+ *
+ * Playouts are random but not blind: a side that can win at once does,
+ * a single threat is blocked, and no move goes right under an opponent
+ * threat (FourInARow_Position::possible_non_losing_moves()). The tree is
+ * pruned the same way, so hopeless moves never get a node.
+ *
+ * Nodes live in a pool allocated when the player is created and reused
+ * for the whole game. After each move the subtree under the position
+ * actually reached (the AI's move, then the opponent's reply) is copied
+ * to the front of the spare pool and becomes the new root, so its visits
+ * carry over to the next search.
+ *
+ * A search stops after a fixed number of iterations (set_iterations()) or,
+ * when that is 0, at the end of the time budget.
+ */
+class FourInARow_MCTS_Player : public Player<char> {
+private:
+    static const int CELLS = FourInARow_Position::WIDTH * FourInARow_Position::HEIGHT;
+
+    /** @brief How a node's game stands once its move is on the board. */
+    enum Terminal : uint8_t {
+        OPEN = 0, ///< Game goes on
+        WON,      ///< The move completed a line
+        DRAWN     ///< The move filled the board
+    };
+
+    /**
+     * @brief One tree node; its children sit next to each other in the pool
+     */
+    struct Node {
+        uint32_t first_child = 0; ///< Pool index of the first child, 0 while not expanded
+        uint32_t visits = 0;      ///< Playouts through this node
+        float wins = 0;           ///< Their results for the player who made the move (draw = 0.5)
+        int8_t col = -1;          ///< Column of the move into this node
+        uint8_t child_count = 0;
+        Terminal terminal = OPEN;
+    };
+
+    vector<Node> pool;             // Node storage, allocated once
+    vector<Node> spare;            // Second pool the reused subtree is copied into
+    uint32_t used = 0;             // Nodes taken from pool; the root is pool[0]
+    FourInARow_Position root_position; // Position at pool[0]
+    bool has_tree = false;         // pool[0] holds a searched root
+
+    double exploration = 0.7;      // UCT exploration constant
+    int iteration_budget = 0;      // Iterations per move (0 = use the time budget)
+    int time_budget_ms = 300;      // Thinking time per move
+    unsigned long long iterations = 0; // Iterations run for the last move
+    uint32_t reused_visits = 0;    // Root visits inherited from the previous move
+    uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+    /** @brief xorshift64* generator: fast enough to vanish next to the playouts. */
+    uint64_t next_random() {
+        rng_state ^= rng_state >> 12;
+        rng_state ^= rng_state << 25;
+        rng_state ^= rng_state >> 27;
+        return rng_state * 0x2545F4914F6CDD1DULL;
+    }
+
+    /** @brief A uniformly chosen set bit of moves (moves != 0). */
+    uint64_t random_move(uint64_t moves) {
+        int skip = int(((next_random() >> 32) * uint64_t(__builtin_popcountll(moves))) >> 32);
+        for (; skip > 0; skip--) moves &= moves - 1;
+        return moves & (0 - moves);
+    }
+
+    static int column_of(uint64_t move) {
+        return __builtin_ctzll(move) / (FourInARow_Position::HEIGHT + 1);
+    }
+
+    static bool same_position(const FourInARow_Position& a, const FourInARow_Position& b) {
+        return a.get_mask() == b.get_mask() && a.get_current() == b.get_current();
+    }
+
+    /**
+     * @brief Play pos out at random
+     * @return Result for the side to move in pos: 1 win, 0.5 draw, 0 loss
+     */
+    float playout(FourInARow_Position pos) {
+        float result = 1;
+        while (true) {
+            if (pos.nb_moves() == CELLS) return 0.5f;
+            if (pos.can_win_next()) return result;
+            uint64_t next = pos.possible_non_losing_moves();
+            if (next == 0) return 1 - result;
+            pos.play(random_move(next));
+            result = 1 - result;
+        }
+    }
+
+    /**
+     * @brief Give node one child per sensible move of pos
+     * @return false if the pool is full (the node stays a leaf)
+     */
+    bool expand(uint32_t node, const FourInARow_Position& pos) {
+        uint64_t moves = pos.possible();
+        uint64_t winning = moves & pos.winning_position();
+        if (winning) {
+            moves = winning & (0 - winning); // One winning child says it all
+        } else {
+            uint64_t safe = pos.possible_non_losing_moves();
+            if (safe) moves = safe;         // Otherwise every move loses; keep them all
+        }
+
+        int count = __builtin_popcountll(moves);
+        if (used + count > pool.size()) return false;
+
+        Node& parent = pool[node];
+        parent.first_child = used;
+        parent.child_count = uint8_t(count);
+        for (; moves; moves &= moves - 1) {
+            uint64_t move = moves & (0 - moves);
+            Node& child = pool[used++];
+            child = Node();
+            child.col = int8_t(column_of(move));
+            if (move & winning) child.terminal = WON;
+            else if (pos.nb_moves() + 1 == CELLS) child.terminal = DRAWN;
+        }
+        return true;
+    }
+
+    /** @brief Child of node with the best UCT value; unvisited children go first. */
+    uint32_t select_child(uint32_t node) const {
+        const Node& parent = pool[node];
+        double log_visits = log(double(parent.visits));
+        uint32_t best = parent.first_child;
+        double best_value = -1;
+        for (uint32_t i = parent.first_child; i < parent.first_child + parent.child_count; i++) {
+            const Node& child = pool[i];
+            if (child.visits == 0) return i;
+            double value = child.wins / child.visits + exploration * sqrt(log_visits / child.visits);
+            if (value > best_value) {
+                best_value = value;
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    /** @brief One select / expand / playout / backpropagate pass. */
+    void iterate() {
+        uint32_t path[CELLS + 1];
+        int length = 0;
+        uint32_t node = 0;
+        FourInARow_Position pos = root_position;
+        path[length++] = node;
+
+        while (pool[node].first_child != 0 && pool[node].terminal == OPEN) {
+            node = select_child(node);
+            pos.play_column(pool[node].col);
+            path[length++] = node;
+        }
+
+        // result is for the player who made the move into node
+        float result;
+        if (pool[node].terminal == WON) {
+            result = 1;
+        } else if (pool[node].terminal == DRAWN) {
+            result = 0.5f;
+        } else {
+            if ((node == 0 || pool[node].visits > 0) && expand(node, pos)) {
+                node = select_child(node);
+                pos.play_column(pool[node].col);
+                path[length++] = node;
+            }
+            Terminal t = pool[node].terminal;
+            result = t == WON ? 1 : t == DRAWN ? 0.5f : 1 - playout(pos);
+        }
+
+        for (int i = length - 1; i >= 0; i--) {
+            Node& n = pool[path[i]];
+            n.visits++;
+            n.wins += result;
+            result = 1 - result;
+        }
+    }
+
+    /**
+     * @brief Make the node for pos the root, keeping its subtree, or start afresh
+     *
+     * pos is looked for one and two plies below the old root: after the
+     * AI's own move and after the opponent's reply.
+     */
+    void set_root(const FourInARow_Position& pos) {
+        uint32_t found = 0;
+        if (has_tree && pos.nb_moves() > root_position.nb_moves() &&
+            pos.nb_moves() <= root_position.nb_moves() + 2) {
+            const Node& root = pool[0];
+            for (uint32_t i = root.first_child; !found && i < root.first_child + root.child_count; i++) {
+                FourInARow_Position p1 = root_position;
+                p1.play_column(pool[i].col);
+                if (same_position(p1, pos)) { found = i; break; }
+                const Node& child = pool[i];
+                for (uint32_t j = child.first_child; j < child.first_child + child.child_count; j++) {
+                    FourInARow_Position p2 = p1;
+                    p2.play_column(pool[j].col);
+                    if (same_position(p2, pos)) { found = j; break; }
+                }
+            }
+        }
+
+        if (!found) {
+            pool[0] = Node();
+            used = 1;
+        } else {
+            // Breadth-first copy: spare doubles as the queue, children stay contiguous
+            spare[0] = pool[found];
+            uint32_t copied = 1;
+            for (uint32_t i = 0; i < copied; i++) {
+                Node& n = spare[i];
+                if (n.first_child == 0) continue;
+                uint32_t from = n.first_child;
+                n.first_child = copied;
+                for (int c = 0; c < n.child_count; c++) spare[copied++] = pool[from + c];
+            }
+            pool.swap(spare);
+            used = copied;
+        }
+        root_position = pos;
+        has_tree = true;
+        reused_visits = pool[0].visits;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param name Player name
+     * @param symbol Player symbol ('X' or 'O')
+     * @param pool_size Tree nodes allocated up front (two pools of this size)
+     */
+    FourInARow_MCTS_Player(string name, char symbol, size_t pool_size = size_t(1) << 19)
+        : Player<char>(name, symbol, PlayerType::AI), pool(pool_size), spare(pool_size) {
+        rng_state ^= uint64_t(symbol) << 32 | uint64_t(pool_size);
+    }
+
+    /**
+     * @brief Run a fixed number of iterations per move (0 = use the time budget)
+     */
+    void set_iterations(int count) { iteration_budget = count; }
+
+    /** @brief Set the thinking time per move (milliseconds). */
+    void set_time_budget(int milliseconds) { time_budget_ms = milliseconds; }
+
+    /** @brief Set the UCT exploration constant. */
+    void set_exploration(double c) { exploration = c; }
+
+    /** @brief Seed the playout generator (games repeat with the same seed). */
+    void set_seed(uint64_t seed) { rng_state = seed ? seed : 0x9E3779B97F4A7C15ULL; }
+
+    /** @brief Iterations run for the last move. */
+    unsigned long long get_iterations() const { return iterations; }
+
+    /** @brief Root visits inherited from the previous move's tree. */
+    unsigned get_reused_visits() const { return reused_visits; }
+
+    /** @brief Tree nodes in use after the last move. */
+    size_t get_tree_size() const { return used; }
+
+    /**
+     * @brief Get best move for the board the player is attached to
+     */
+    int get_best_column() {
+        if (const FourInARow_Board* board = dynamic_cast<const FourInARow_Board*>(boardPtr))
+            return get_best_column(board->get_position());
+        return get_best_column(FourInARow_Position::from_view(boardPtr->get_board_view(), symbol));
+    }
+
+    /**
+     * @brief Get best move for a position with the player to move, without a board
+     */
+    int get_best_column(const FourInARow_Position& pos) {
+        iterations = 0;
+        uint64_t possible = pos.possible();
+        if (possible == 0) return FourInARow_Position::WIDTH / 2;
+
+        // Wins and forced replies need no search
+        uint64_t winning = possible & pos.winning_position();
+        if (winning) return column_of(winning);
+        uint64_t next = pos.possible_non_losing_moves();
+        if (next == 0) return column_of(possible & (0 - possible));
+        if ((next & (next - 1)) == 0) return column_of(next);
+
+        set_root(pos);
+        auto deadline = chrono::steady_clock::now() + chrono::milliseconds(time_budget_ms);
+        // At least one iteration, so the root has children to choose from
+        do {
+            iterate();
+            iterations++;
+        } while (iteration_budget > 0
+                     ? iterations < (unsigned long long)iteration_budget
+                     : (iterations & 63) != 0 || chrono::steady_clock::now() < deadline);
+
+        // Play the most visited child
+        const Node& root = pool[0];
+        uint32_t best = root.first_child;
+        for (uint32_t i = root.first_child; i < root.first_child + root.child_count; i++)
+            if (pool[i].visits > pool[best].visits) best = i;
+        return pool[best].col;
+    }
+};
+
+#endif // FOUR_IN_A_ROW_MCTS_PLAYER_H
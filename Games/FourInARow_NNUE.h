@@ -0,0 +1,181 @@
+// FourInARow_NNUE.h
+// Quantized, incrementally updated evaluation network for Four-in-a-Row
+
+#ifndef FOUR_IN_A_ROW_NNUE_H
+#define FOUR_IN_A_ROW_NNUE_H
+
+#include "FourInARow_Solver.h"
+#include "FourInARow_NNUE_Weights.h"
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Two-layer evaluation network with an incrementally updated first layer.
+ *
+ * There are 84 binary inputs per point of view: "my disc on cell c" and
+ * "their disc on cell c". The first layer turns them into HIDDEN int16 sums
+ * (the accumulator), one set per side. Dropping a disc only adds one weight
+ * row to each side's sums and lifting it subtracts the row again, so the
+ * search never recomputes the first layer.
+ *
+ * At a leaf both halves are clipped to [0, ACTIVATION_MAX] and packed to
+ * 8 bits, the side to move first, and a dot product with the int8 output
+ * weights gives the score. The weights come from tools/FourInARow_Trainer.cpp.
+ *
+ * AVX2 or SSSE3 builds (-mavx2, -mssse3, -march=native) use SIMD; every
+ * other target runs the scalar loops, which give the same results.
+ */
+class FourInARow_NNUE {
+public:
+    static const int CELLS = FourInARow_Position::WIDTH * FourInARow_Position::HEIGHT;
+    static const int INPUTS = 2 * CELLS;                          ///< Own discs, then the other side's
+    static const int HIDDEN = FourInARow_NNUE_Weights::HIDDEN;   ///< Accumulator width per side
+    static const int ACTIVATION_MAX = 127;                       ///< 1.0 after the clipped ReLU
+    static const int OUTPUT_WEIGHT_SCALE = 64;                   ///< 1.0 as an output weight
+    static const int OUTPUT_SHIFT = 3;                           ///< Divides the raw dot product into score units
+
+    static_assert(HIDDEN % 32 == 0, "HIDDEN must fill whole AVX2 registers");
+
+    /**
+     * @brief First-layer sums for both points of view
+     *
+     * values[side] treats side's discs as "mine"; the sides are whatever the
+     * caller passes to add() and remove() (the AI uses 0 for itself).
+     */
+    struct alignas(32) Accumulator {
+        int16_t values[2][HIDDEN];
+    };
+
+private:
+    using W = FourInARow_NNUE_Weights;
+
+    /** @brief Network input of a cell bit index (col * 7 + h -> col * 6 + h). */
+    static int cell_index(int bit) {
+        return bit - bit / (FourInARow_Position::HEIGHT + 1);
+    }
+
+    static void add_row(int16_t* acc, const int16_t* row) {
+#if defined(__AVX2__)
+        for (int i = 0; i < HIDDEN; i += 16) {
+            __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc + i));
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(row + i));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(acc + i), _mm256_add_epi16(a, w));
+        }
+#else
+        for (int i = 0; i < HIDDEN; i++) acc[i] += row[i];
+#endif
+    }
+
+    static void sub_row(int16_t* acc, const int16_t* row) {
+#if defined(__AVX2__)
+        for (int i = 0; i < HIDDEN; i += 16) {
+            __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc + i));
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(row + i));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(acc + i), _mm256_sub_epi16(a, w));
+        }
+#else
+        for (int i = 0; i < HIDDEN; i++) acc[i] -= row[i];
+#endif
+    }
+
+    /**
+     * @brief Clipped ReLU of one half of the accumulator dotted with its output weights
+     */
+    static int32_t dot_half(const int16_t* acc, const int8_t* weights) {
+#if defined(__AVX2__)
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i top = _mm256_set1_epi16(ACTIVATION_MAX);
+        const __m256i ones = _mm256_set1_epi16(1);
+        __m256i sum = _mm256_setzero_si256();
+        for (int i = 0; i < HIDDEN; i += 32) {
+            __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc + i));
+            __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc + i + 16));
+            a = _mm256_min_epi16(_mm256_max_epi16(a, zero), top);
+            b = _mm256_min_epi16(_mm256_max_epi16(b, zero), top);
+            // packus interleaves 128-bit lanes; the permute puts them back in order
+            __m256i act = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(weights + i));
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(act, w), ones));
+        }
+        __m128i s = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+        return _mm_cvtsi128_si32(s);
+#elif defined(__SSSE3__)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i top = _mm_set1_epi16(ACTIVATION_MAX);
+        const __m128i ones = _mm_set1_epi16(1);
+        __m128i sum = _mm_setzero_si128();
+        for (int i = 0; i < HIDDEN; i += 16) {
+            __m128i a = _mm_load_si128(reinterpret_cast<const __m128i*>(acc + i));
+            __m128i b = _mm_load_si128(reinterpret_cast<const __m128i*>(acc + i + 8));
+            a = _mm_min_epi16(_mm_max_epi16(a, zero), top);
+            b = _mm_min_epi16(_mm_max_epi16(b, zero), top);
+            __m128i act = _mm_packus_epi16(a, b);
+            __m128i w = _mm_load_si128(reinterpret_cast<const __m128i*>(weights + i));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_maddubs_epi16(act, w), ones));
+        }
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+        return _mm_cvtsi128_si32(sum);
+#else
+        int32_t sum = 0;
+        for (int i = 0; i < HIDDEN; i++) {
+            int v = acc[i] < 0 ? 0 : acc[i] > ACTIVATION_MAX ? ACTIVATION_MAX : acc[i];
+            sum += v * weights[i];
+        }
+        return sum;
+#endif
+    }
+
+public:
+    /** @brief Empty board: both halves start at the first-layer biases. */
+    static void reset(Accumulator& acc) {
+        for (int side = 0; side < 2; side++)
+            for (int i = 0; i < HIDDEN; i++) acc.values[side][i] = W::feature_bias[i];
+    }
+
+    /**
+     * @brief Put side's disc on a cell
+     * @param bit Cell as a FourInARow_Position bit index
+     * @param side 0 or 1
+     */
+    static void add(Accumulator& acc, int bit, int side) {
+        int cell = cell_index(bit);
+        add_row(acc.values[side], W::feature_weights[cell]);
+        add_row(acc.values[side ^ 1], W::feature_weights[CELLS + cell]);
+    }
+
+    /** @brief Take side's disc off a cell (inverse of add()). */
+    static void remove(Accumulator& acc, int bit, int side) {
+        int cell = cell_index(bit);
+        sub_row(acc.values[side], W::feature_weights[cell]);
+        sub_row(acc.values[side ^ 1], W::feature_weights[CELLS + cell]);
+    }
+
+    /**
+     * @brief Rebuild from scratch: side 0 owns stones0, side 1 owns stones1
+     */
+    static void refresh(Accumulator& acc, uint64_t stones0, uint64_t stones1) {
+        reset(acc);
+        for (; stones0; stones0 &= stones0 - 1) add(acc, __builtin_ctzll(stones0), 0);
+        for (; stones1; stones1 &= stones1 - 1) add(acc, __builtin_ctzll(stones1), 1);
+    }
+
+    /**
+     * @brief Score for side_to_move; about 1000 units per unit of win log-odds
+     */
+    static int evaluate(const Accumulator& acc, int side_to_move) {
+        int32_t sum = W::output_bias
+                    + dot_half(acc.values[side_to_move], W::output_weights)
+                    + dot_half(acc.values[side_to_move ^ 1], W::output_weights + HIDDEN);
+        return sum >> OUTPUT_SHIFT;
+    }
+};
+
+#endif // FOUR_IN_A_ROW_NNUE_H
@@ -0,0 +1,110 @@
+// FourInARow_NNUE_Weights.h
+// Generated by tools/FourInARow_Trainer.cpp from 130801 self-play positions
+// (validation log loss 0.4251). Regenerate rather than edit.
+
+#ifndef FOUR_IN_A_ROW_NNUE_WEIGHTS_H
+#define FOUR_IN_A_ROW_NNUE_WEIGHTS_H
+
+#include <cstdint>
+
+/**
+ * @brief Quantized weights of FourInARow_NNUE
+ */
+struct FourInARow_NNUE_Weights {
+    static const int HIDDEN = 64;
+
+    alignas(32) static constexpr int16_t feature_weights[84][HIDDEN] = {
+        {32,28,-40,-3,-33,-27,51,-62,-28,-36,-23,6,-15,0,-18,-18,0,-17,23,-28,9,-65,-2,-13,-22,-35,-22,27,18,-25,-56,-5,-6,-5,43,-27,-80,23,-42,23,13,-9,26,-31,17,-2,-10,-2,12,4,-22,9,-18,-22,2,-65,12,27,14,-54,-21,-20,-66,-19},
+        {9,29,-42,-17,36,-11,-21,-34,5,46,16,48,63,36,31,-27,62,15,62,-44,-59,73,-7,-26,-14,-1,-4,-9,-39,25,67,-25,-41,13,12,-13,89,25,6,117,-7,32,-13,23,9,-9,-21,-13,29,13,-38,2,-15,-11,18,-24,2,-8,20,18,-3,0,77,-91},
+        {4,-10,-41,0,-1,-21,7,19,12,15,4,30,-3,54,2,-26,-13,7,5,-32,-29,-86,-9,-44,-18,-60,-5,14,-12,-19,-44,-8,-29,37,-6,-2,-86,20,-18,1,12,-6,-1,19,-8,-5,28,45,-38,-4,-29,17,-21,6,-10,-50,-35,30,4,-10,69,17,-7,-11},
+        {-24,-3,-35,42,4,-40,21,9,37,-13,-11,20,-9,18,26,-28,9,-50,10,18,-4,71,-67,6,13,-24,-19,-51,-23,-41,32,83,2,11,-3,-73,89,-14,29,226,0,59,-16,-14,-1,-16,-24,13,28,-15,-124,54,-32,52,-48,10,-4,-28,-22,-24,10,45,68,-27},
+        {7,13,6,1,-5,-7,76,21,28,-92,-8,-26,-29,-24,12,22,6,-10,3,24,22,-85,-2,-7,-19,8,34,4,-10,-22,-30,32,13,3,31,-15,-89,-8,-42,-26,44,83,2,-3,18,-4,-4,-26,-2,-28,16,-38,30,-23,8,-35,7,-33,-10,18,0,-10,-3,-27},
+        {20,14,-19,13,18,3,18,-3,-24,-1,-35,-45,53,-5,-9,-9,4,7,3,-60,-90,86,25,-33,46,-21,-24,13,14,19,97,-13,57,33,2,2,118,30,-36,34,-37,93,-200,1,0,-8,-84,0,-16,2,13,-2,14,-58,-5,-52,-24,-8,19,5,17,27,9,-37},
+        {22,16,-8,-3,-42,16,-13,-1,55,-51,5,-21,-19,-9,17,-27,2,54,-3,-6,-9,-3,-10,5,12,7,-13,-77,21,-27,-5,-8,-5,-6,-2,3,-11,10,1,-10,-3,46,-21,-2,28,77,7,-33,-30,-20,-48,36,-15,-36,3,-35,-32,40,27,-1,-26,-13,-4,-43},
+        {43,-33,-27,-1,-45,87,20,19,-56,-18,-16,-76,56,15,-82,4,-15,-27,31,44,42,-6,16,-15,-45,-20,-19,-43,39,-18,17,6,-7,-26,3,-21,28,8,-37,-4,50,35,-19,-7,8,46,-22,38,24,59,9,-15,-15,41,-15,7,-2,29,-11,14,6,-25,-45,18},
+        {-18,-34,-57,-12,-21,-83,-20,-15,-61,0,-4,3,49,65,4,-4,39,31,-13,8,15,-13,-20,-39,-6,7,80,-17,31,-2,-24,-37,-37,-71,-8,44,-49,27,49,-14,77,-32,5,12,25,45,45,26,-30,42,49,52,-35,28,-5,-8,8,39,13,40,9,64,-36,-66},
+        {20,16,-19,15,-34,-14,78,36,26,-9,11,20,-42,-41,-64,46,50,20,2,69,12,12,-79,-2,-14,-59,23,-3,-24,22,16,50,47,6,51,-7,49,-24,-27,21,-1,-4,-33,27,39,6,3,28,26,-5,-20,-17,-3,28,-15,-30,29,46,-4,70,0,25,25,24},
+        {22,15,4,14,2,10,-10,41,-24,-8,8,24,31,-56,-30,43,-2,-2,32,27,6,9,-28,3,-11,-38,19,77,-5,22,-23,38,26,-43,50,-1,-70,43,13,7,68,-8,-45,-22,17,21,-36,-14,24,5,-10,22,3,-5,31,-9,-11,12,-18,-19,24,-9,24,31},
+        {19,6,-7,23,1,-5,2,17,10,2,33,-34,54,2,-35,10,5,-18,12,-47,11,77,-25,20,8,-26,36,-25,-12,-1,54,-4,35,4,2,-7,87,44,-34,-37,6,8,-6,3,16,2,0,15,-26,-27,-33,-11,5,7,4,4,-20,-3,7,-4,19,-3,19,-12},
+        {15,-29,-18,38,-44,24,-89,-9,7,21,-3,-91,72,-28,22,20,-3,1,-2,2,44,-10,-3,-8,10,50,3,-10,26,-1,8,-17,-13,35,40,6,1,-27,-5,52,14,8,-4,14,14,12,-67,-15,-4,-49,-25,17,-46,-13,26,112,9,58,38,-36,-46,-31,49,-18},
+        {18,26,-10,-37,-50,51,-36,15,-14,-12,-13,7,-4,-28,27,-27,-11,-19,2,-18,9,-11,50,-27,-14,-32,-22,-15,-4,19,-18,-47,-7,-47,19,123,-2,45,-76,43,-2,-7,8,-18,15,-72,32,-29,-17,-26,-41,66,-48,-29,38,89,-6,-83,12,-34,-81,-66,2,-30},
+        {20,-106,-36,91,-74,-60,-17,22,35,71,-59,-37,-20,0,14,-11,-35,16,-49,-23,-6,-35,-57,46,59,3,14,35,53,-55,-7,-60,27,16,1,27,-15,-11,-40,53,-61,15,-58,-18,20,-10,-2,-41,-30,-57,-31,43,-36,-30,-3,28,29,-49,-7,4,-38,0,-9,-37},
+        {-5,-44,-25,-62,-41,-53,-3,-36,27,35,-48,-27,18,-82,-27,-66,72,-51,-20,3,107,-5,-6,-34,-27,-11,2,6,20,-30,-25,35,32,14,2,16,10,26,-25,7,-31,2,12,53,-5,37,-45,33,-13,58,9,31,102,-7,15,16,18,-47,40,42,-8,-21,-35,-15},
+        {-3,78,0,15,-39,-5,27,-3,14,-20,31,-13,75,-37,-22,7,17,21,-46,-1,12,-20,-27,-18,13,-24,-10,-7,5,-3,6,-8,-41,0,30,13,-23,4,-19,57,-15,-15,1,21,-41,-29,-13,-51,-1,-15,9,5,19,-3,17,13,12,-2,48,-4,10,-55,28,-8},
+        {-2,26,-6,16,-11,0,19,15,-7,-11,15,8,-44,-3,12,10,39,25,-21,33,-16,16,-46,-23,-54,-2,-10,5,-7,14,55,0,-55,10,-14,17,61,40,-13,-9,18,-10,24,18,33,33,-12,0,3,-21,-42,23,-50,-20,-13,-11,94,-83,29,-3,-18,23,1,-19},
+        {48,-30,-49,-31,-23,-6,-83,31,-21,-30,-23,-16,-42,-27,-51,42,-29,-27,3,24,-42,-7,-47,-18,28,-4,2,-57,26,-90,3,-53,-29,-5,40,-29,-6,-38,-33,-55,6,107,18,14,-42,21,10,17,2,-34,-9,-83,-55,-19,-34,-51,43,53,7,11,-11,-8,58,-33},
+        {-18,-11,47,20,-3,70,44,-83,-71,-81,13,-48,13,-24,8,42,56,49,-72,-33,-23,-19,57,3,23,5,-35,31,45,-77,-6,-66,-10,23,-25,63,3,-57,5,-12,67,-8,-8,34,-62,-18,-2,-43,47,16,8,-64,-59,-57,65,-25,-22,-23,25,13,-22,-40,-53,51},
+        {-11,20,-33,-10,-64,-31,-17,45,-48,-79,-16,11,4,13,-43,-66,41,-13,-104,-16,-57,-27,-58,88,62,-8,81,65,-117,19,-15,56,-4,48,-91,-41,5,-28,-20,-35,-57,-11,20,79,25,-64,20,91,106,16,73,-81,-71,61,10,11,-18,-60,-81,24,-19,-23,14,19},
+        {51,0,-42,-47,-32,-49,-10,81,18,-36,59,6,-20,-41,-4,49,41,77,-18,37,8,-16,-39,24,31,-33,5,1,2,15,4,-15,0,-84,2,-33,-11,70,-13,-15,43,-2,44,-19,-33,1,-29,-27,-47,11,55,65,8,-34,-19,-22,-19,7,98,0,-66,37,13,47},
+        {1,-6,-11,12,-21,-39,15,-11,-1,23,20,14,-13,-11,-18,79,37,14,8,44,6,-19,-8,6,14,-72,34,-9,-31,21,-6,8,4,-18,-12,-17,-8,22,-16,2,8,-27,32,-3,28,-47,-9,3,-67,-79,31,-2,58,125,-34,-8,-21,9,63,-2,31,20,15,47},
+        {61,32,3,-9,-11,-13,-44,25,29,-30,25,41,-20,0,30,49,32,12,-19,76,-36,-10,-35,14,62,-22,19,24,-3,-3,34,-5,6,34,58,-23,38,78,-15,9,67,11,19,2,17,-9,13,-27,-20,-60,-16,2,4,55,-36,-15,19,12,86,2,69,-4,-2,38},
+        {14,-6,-19,91,-8,-1,4,-15,41,19,21,-90,-89,4,5,7,-42,-20,8,38,-11,-10,-4,-40,-34,-21,5,-8,-1,2,2,-16,-64,-43,-8,20,0,34,-12,15,22,-37,-6,-14,24,-3,-23,3,45,-114,-13,-21,-34,14,-53,5,18,36,17,-5,14,-23,-38,23},
+        {26,15,75,-40,39,-10,-46,42,-30,26,-16,9,39,65,17,-18,-5,-3,-13,-20,72,-17,-5,-11,14,-47,-25,-28,42,42,-12,-4,-31,-11,-55,-60,0,46,-7,-21,-12,1,43,-29,-53,-18,25,56,41,-39,-12,38,68,-18,4,-7,-10,-8,23,8,-6,-64,49,-20},
+        {29,-45,-46,35,-21,-21,4,17,12,98,-3,-3,-11,84,40,-20,-30,-37,4,13,25,-36,-15,-15,9,-50,4,25,48,-1,-18,-52,5,42,-74,40,-14,26,-44,-6,-27,-19,-4,23,27,6,-45,31,41,-71,-5,41,-44,1,-100,-44,44,-16,-5,31,40,-39,60,-5},
+        {-1,59,-1,2,-79,-17,17,-9,16,19,-19,18,16,-19,15,-54,49,-17,38,-56,-30,-27,-26,-23,89,-59,19,10,-31,3,-17,-18,27,55,-6,9,6,-17,-38,63,-3,3,-40,-27,-26,-64,-24,-27,-38,2,-7,58,16,-34,-42,48,68,-38,24,1,-74,4,40,25},
+        {-1,9,-21,54,-17,-16,-25,18,10,-2,29,-2,-9,-21,1,-13,-12,43,25,7,17,0,4,-6,-13,55,-2,6,-30,5,7,-5,12,-4,10,-26,-21,26,-15,-29,-17,-30,39,-13,-39,3,-41,3,-28,-2,17,2,39,-53,9,-11,-12,10,44,40,-8,-36,25,-9},
+        {-12,35,-28,41,13,-10,16,41,27,4,2,4,-12,36,24,5,34,5,-4,-1,-6,-2,-18,9,35,60,-14,-39,-1,8,51,-9,-11,-24,5,-6,59,35,-16,6,0,7,-12,-28,36,10,16,20,17,26,-23,25,1,-4,-17,-46,19,13,24,3,-30,5,24,-23},
+        {11,28,-30,34,-21,-13,-21,-9,8,-48,13,6,-42,35,-9,-65,1,-3,1,53,0,-13,-18,-12,9,-3,-74,-90,-7,-20,-13,-22,-53,-32,-24,37,-14,26,9,-4,16,-15,36,4,-69,-13,-16,80,39,-13,-21,13,-22,-9,-8,-47,-52,36,31,1,4,-22,-73,-9},
+        {60,-38,26,23,17,-63,-12,52,-62,-42,-30,-37,-36,-6,-60,22,0,-13,-33,-5,-9,-6,-15,3,8,39,-42,-20,-17,-11,20,-29,-19,23,-9,15,28,19,-48,34,20,-5,8,-57,50,4,-8,44,34,68,27,8,20,14,46,38,-29,23,-6,-1,-7,9,-18,8},
+        {-12,6,-40,-21,-59,-24,4,-67,-39,8,53,-5,-5,-14,1,-3,7,-7,-30,62,-6,-3,-27,13,51,77,45,-82,73,-28,-24,-12,-10,29,63,-26,-49,7,22,71,66,12,20,-43,33,-12,25,18,57,46,56,62,18,-14,-4,33,-11,14,11,-42,-8,20,-22,-21},
+        {16,26,-63,-1,-5,-16,-47,-21,10,-27,65,-13,-44,18,-49,19,34,-38,8,38,-7,1,-22,-27,33,66,43,-65,-47,59,5,15,29,46,27,-31,45,-27,-58,32,16,-53,12,10,5,6,26,-23,12,2,-6,-19,-1,44,56,-40,41,40,-5,41,-8,14,-38,13},
+        {12,33,-20,7,14,-36,36,24,16,14,14,-5,17,-18,-15,77,5,28,15,-31,-35,17,-4,-15,15,-16,-9,-25,-42,10,-9,-11,7,14,18,-41,-64,56,45,-14,74,3,-3,24,-3,57,-12,-38,-43,27,-22,18,-10,-3,1,-7,17,18,-2,-85,26,-1,-36,13},
+        {4,23,-23,9,11,13,-13,-11,47,-1,4,15,-4,17,-60,-2,15,15,21,-21,-5,69,-5,-29,3,-8,-13,23,4,18,55,18,15,38,-12,-14,88,43,-46,4,25,64,-22,35,8,15,-5,5,12,-10,-28,15,-37,19,2,-23,-12,-16,18,0,14,-7,-8,-4},
+        {34,59,-16,13,-21,-25,-24,-26,-16,-31,-2,4,-4,6,-18,-3,34,-28,-40,-25,-38,-65,-42,-15,22,48,0,12,5,-24,-54,-6,-5,-18,-2,-14,-79,-4,3,13,11,5,27,4,44,26,12,16,3,11,-20,32,10,-23,-21,-18,-13,24,15,11,22,0,-9,5},
+        {25,32,4,-12,19,-10,36,-7,13,12,18,27,-34,-4,30,-43,62,-4,49,-83,-48,78,-12,-3,10,-36,1,-20,-14,-9,66,5,43,37,-16,-15,90,46,-36,7,12,-15,23,30,76,-30,5,3,17,-25,-13,-18,13,-23,21,17,-5,11,11,12,-8,0,-44,-41},
+        {6,4,-23,-20,-19,-45,9,13,1,30,21,-14,1,24,20,4,-2,34,6,-48,-60,-82,-18,44,23,-7,-5,37,43,-20,-51,-15,-30,38,-16,-4,-83,22,-28,52,-3,-8,-59,-58,55,11,0,18,38,-25,11,26,-3,41,-31,2,51,34,5,-28,-30,31,20,3},
+        {-20,43,-62,43,-18,-3,-35,-11,-11,-25,-36,-3,17,24,48,-33,6,-23,42,20,-50,68,18,-16,18,-31,-15,-16,20,3,43,-3,41,19,-1,21,88,34,-12,-4,16,-217,-31,20,22,-23,20,-13,9,-14,-37,51,-1,31,12,5,91,-14,-15,15,-7,-2,-33,-30},
+        {-3,89,-3,-28,-24,-63,1,2,5,-62,-3,-19,-39,50,10,16,-4,-23,-49,29,-33,-84,12,-17,-76,35,28,3,62,32,-26,14,-24,1,33,4,-89,-29,-1,-7,23,-42,-3,-16,-31,-29,34,-28,-20,-12,20,-19,26,-2,-7,50,11,46,2,-14,-53,-10,13,-1},
+        {6,-9,-25,-25,-11,-9,13,21,8,-5,-18,-65,1,20,-40,7,54,-19,-42,-14,10,96,3,5,-33,-13,-90,-58,-36,23,76,-11,21,-10,11,2,122,86,-24,-8,1,-79,69,16,1,-7,-48,15,17,-20,-46,9,13,17,-36,-22,-73,-24,9,26,2,24,-15,-41},
+        {-22,-23,29,-37,5,18,-31,-17,-6,-13,10,13,-6,-44,12,18,-56,25,11,34,18,-70,62,22,11,25,-5,-27,53,-9,-54,-2,-35,-10,19,16,-74,-65,14,20,-13,-21,-13,-26,-44,29,-20,-23,15,5,15,-9,-17,-42,-3,60,-53,-38,-23,-32,40,-25,-9,45},
+        {-22,-42,44,85,25,-45,3,-2,-12,38,42,-18,-29,-21,-11,40,-38,-10,9,9,8,79,-19,-10,22,19,-2,-15,16,20,70,5,-6,22,-45,-8,86,27,29,-12,-7,-12,-12,-1,-29,28,-15,-21,30,4,20,-8,8,5,17,-1,2,-21,1,38,4,-6,-22,-14},
+        {14,30,20,30,-13,20,39,-29,9,-24,-41,84,25,-30,-41,16,12,3,-12,27,-21,-67,-2,8,-6,21,15,29,-29,2,-48,29,-40,-42,1,-33,-90,-37,2,41,21,-51,-4,-56,-30,11,-15,-53,-36,-9,-2,-43,50,4,19,18,29,-15,26,-2,-37,-15,3,59},
+        {15,-5,11,-45,-16,32,-38,-30,-4,-7,35,6,20,-25,-30,-34,54,45,-57,-2,-11,73,10,36,-17,24,28,9,-6,-6,47,-8,26,-9,20,5,80,-2,68,21,-39,-37,-18,23,-9,-1,-7,-23,-48,13,8,-9,-9,-5,-17,11,9,14,17,-2,-12,-5,26,-4},
+        {-26,-3,24,4,-2,-18,-50,19,-36,5,25,9,4,5,1,9,17,-33,3,38,-74,-94,8,19,-16,20,-26,23,20,16,-34,65,-31,-89,-29,58,-92,-148,38,127,7,-78,-123,-23,-42,33,21,24,-6,14,-38,0,-24,49,-13,18,-9,-27,-34,-19,30,-31,49,0},
+        {-23,34,-22,36,33,27,-23,-32,-33,-2,-8,-4,7,3,3,-14,15,-1,27,15,52,67,27,-26,17,-31,32,-42,29,28,57,36,-18,-19,0,30,106,-4,42,-13,-1,21,42,3,-70,5,-17,6,27,15,-68,-7,-11,8,25,29,-15,2,-7,-16,-5,2,15,21},
+        {-45,-35,39,0,-17,38,-9,-17,1,37,-16,-50,4,40,-82,12,-61,0,-30,-19,46,-7,39,8,-55,-18,-26,38,6,-42,-4,28,-11,-48,-1,21,-10,-22,46,-31,-37,-10,-54,-36,-82,-69,22,-12,8,28,8,-3,50,-4,11,36,-25,-48,-35,-2,-39,22,-42,-30},
+        {-14,-5,29,-25,-5,-48,20,6,20,18,10,-33,-45,-26,16,-7,8,23,-32,6,11,-8,-22,44,-17,-16,10,3,-25,9,13,44,18,-67,7,56,18,-19,11,-33,25,13,46,26,20,-22,43,-31,1,-44,0,-33,43,-17,24,-3,15,-2,2,17,20,35,35,27},
+        {-16,29,37,-23,-16,88,76,44,-57,0,3,90,-14,-12,-23,-12,-23,-52,-17,22,50,-18,17,40,-24,-22,2,20,-4,11,-30,102,37,48,8,0,-54,-4,14,38,-50,17,36,-52,-4,18,38,-25,5,-6,-9,24,44,-13,10,-28,6,-37,3,-94,-43,-16,28,33},
+        {9,32,21,-25,20,13,-3,-18,-41,-1,46,21,24,2,-1,-4,27,-17,-34,-32,33,15,35,20,16,38,72,-26,1,25,8,-2,44,48,-4,9,37,-43,-27,13,-19,5,42,-51,-15,-17,11,-36,-4,12,-11,-23,9,-1,-27,-15,-6,-26,29,-12,-26,-12,22,-43},
+        {-30,3,9,1,21,-5,10,-42,-45,-17,-63,85,54,17,29,-32,-13,-35,-9,-50,-14,19,11,15,14,7,-15,-63,12,12,-28,-18,-21,-38,-7,28,-64,-24,1,-13,-17,-37,83,0,36,-2,24,-20,-1,-6,39,5,3,22,-7,1,-25,-4,-40,15,6,36,-60,3},
+        {-32,8,18,-7,11,4,6,25,-21,12,-16,2,7,-20,-11,8,0,-16,-1,8,3,72,6,6,29,-4,7,-26,-27,6,63,-16,67,-8,-22,3,77,1,-6,37,-23,7,19,-10,-2,-3,10,-24,-37,-29,-5,-16,-11,-8,2,-12,16,-9,9,5,-3,6,0,38},
+        {-46,-55,46,-31,-39,37,47,24,-24,37,12,12,5,-38,-2,-21,-23,-3,-47,-15,-6,-11,27,4,0,-36,-18,-24,-33,43,4,7,69,-2,-21,4,1,-60,22,11,-2,-16,-23,53,7,-27,5,-5,36,23,25,13,50,33,47,-59,15,-5,-47,-51,20,21,-18,-6},
+        {4,39,6,16,51,-14,56,-17,18,56,-24,3,-27,43,6,-8,-6,17,34,3,93,-4,-33,35,74,47,22,-10,0,-26,-12,74,6,56,-19,-83,-2,29,-19,-18,13,-9,2,-43,-52,20,-14,22,20,18,2,-6,-108,-11,65,-5,31,-56,16,-37,1,-103,43,17},
+        {-66,61,24,-41,52,44,62,7,-30,-2,42,36,14,-74,41,35,37,-10,-53,41,24,-28,52,-26,-43,-20,45,-7,-30,50,0,77,-63,25,21,63,-20,-34,-2,-57,2,-12,48,76,-23,2,-18,-2,-26,12,7,-56,-1,15,33,42,16,7,3,61,-6,55,-37,29},
+        {-34,39,43,68,30,27,-7,16,-28,64,25,13,-18,-5,57,31,-57,49,20,-13,-17,-5,13,60,48,-1,27,-60,-7,-14,-23,9,-36,-18,10,0,7,-2,4,-94,0,24,-40,5,26,-64,18,-32,-31,-60,6,-21,-29,-1,-25,8,26,-34,0,17,-52,42,-5,6},
+        {-29,-31,-3,-2,54,43,-35,13,31,24,-12,24,-32,3,59,13,82,-36,42,88,0,-13,-4,24,38,58,-5,-1,19,43,-10,-7,62,-46,31,22,-35,7,15,-1,-1,4,-16,26,25,51,17,15,-15,-13,-42,-9,2,18,39,0,67,-18,-32,1,-13,-2,-25,3},
+        {-24,-10,6,-10,13,7,1,2,-33,-21,4,20,20,-32,22,1,11,-8,12,11,-10,22,6,37,15,-8,-36,-12,7,4,51,10,48,10,-3,17,52,0,15,-30,16,5,22,7,-26,6,3,-40,-23,-13,-14,0,27,-31,13,16,17,-28,-8,10,-1,13,0,-1},
+        {-45,24,32,-1,0,28,50,-22,25,-20,48,-76,23,61,6,-19,16,57,0,-5,7,-6,13,-43,-64,-9,-47,-42,10,49,-3,24,8,-24,-55,-6,-5,-77,65,1,-40,-61,-25,-39,10,20,-35,-8,-20,79,13,-78,27,15,-15,35,-81,21,-114,-53,16,-1,-6,28},
+        {48,38,-25,-13,-74,-37,-88,76,21,-19,-56,-69,24,93,39,6,23,-31,-4,27,-64,-33,-26,-40,-37,-58,6,-53,-19,-30,-16,76,7,-24,44,-99,-9,1,-7,2,0,25,-4,-37,2,-1,-56,0,-40,63,47,-140,32,6,26,-2,-14,-25,81,-15,15,33,59,-43},
+        {83,-12,9,15,67,19,-22,-34,53,-68,41,18,1,9,28,66,1,28,12,-20,52,-29,24,-77,-51,-43,10,-37,95,-19,-24,-93,-3,-37,91,-1,-23,55,-42,37,40,20,-21,-62,-3,31,-44,-37,-49,-16,-12,30,13,41,47,-14,19,-12,62,-114,6,-1,0,-9},
+        {-10,22,5,56,53,19,25,0,31,-56,-71,3,-16,33,-17,24,-42,-109,-6,-35,20,-10,-8,-28,-43,17,-11,-3,48,-32,2,-30,9,18,9,7,8,-4,-10,73,16,-3,-24,-13,54,-53,42,37,33,6,11,73,-51,24,66,11,-5,-49,-31,-15,50,-26,-8,-30},
+        {32,22,-21,18,48,11,14,42,40,-88,-11,-1,-12,-17,-6,-22,-3,-15,12,-28,31,0,7,50,19,45,8,35,20,32,-2,5,-35,20,90,12,-4,22,-39,27,80,22,-46,-6,-30,46,35,-31,-14,-8,-61,18,-10,-78,28,-12,-1,-19,-69,-12,1,-9,-33,-27},
+        {42,19,9,34,30,33,41,-32,7,16,-22,-14,46,-9,-12,-25,29,-53,21,-58,24,3,3,20,-8,23,8,9,-9,18,47,17,7,17,-28,-14,40,21,-49,22,12,48,6,-33,8,-8,2,-26,-16,-37,27,9,58,-5,38,-7,-78,-8,-10,16,-7,3,-3,20},
+        {-38,-3,29,-108,-10,37,-5,11,82,36,-5,0,47,19,-3,-19,-49,27,-6,-7,-11,-7,76,63,-26,31,28,-55,13,5,4,45,-4,-10,-24,1,0,-15,25,-6,2,43,1,8,-45,-38,38,-5,14,19,52,-17,4,26,-88,20,75,-57,-57,-2,37,9,-64,22},
+        {-16,47,-47,51,-40,31,73,2,130,46,12,28,-68,-3,-25,20,27,-26,-39,50,-78,3,17,-22,-11,-18,43,-2,-35,42,-6,50,-10,-4,17,94,1,13,23,12,12,-15,-39,28,40,46,-65,-19,13,9,9,1,-11,38,-23,2,68,-37,31,-28,-13,-157,-20,17},
+        {-76,92,36,-10,23,29,-6,31,-33,7,-2,-22,7,-16,7,5,28,58,58,-15,-49,-23,13,51,-25,74,-24,25,-49,-34,-13,19,-24,-16,63,-19,-20,-4,-15,71,-1,23,43,-23,-7,4,-10,19,-63,29,35,-72,51,11,47,46,39,-63,7,-5,-107,54,-22,73},
+        {-20,-29,8,40,36,18,28,25,-2,28,35,13,20,-4,23,13,-27,36,7,7,22,-24,52,6,-91,23,-7,18,20,57,-18,-13,-18,-110,1,-25,7,-31,-2,56,-17,-27,41,81,65,79,-20,64,-2,-32,-30,-28,19,44,26,-52,16,-7,-1,-33,-83,31,63,-12},
+        {-31,44,1,-24,8,3,42,-2,-30,15,12,-6,45,13,38,8,26,-56,9,-17,-17,6,14,27,-10,29,-13,-12,34,47,4,-6,-81,4,25,32,-30,-10,24,79,15,21,-32,42,29,-28,20,1,0,-27,-51,-7,2,72,1,-15,102,-33,-29,-37,18,22,-41,-1},
+        {-34,-13,18,-43,31,18,16,-4,-16,10,-15,0,9,12,17,7,24,6,-1,26,3,7,-10,36,33,-17,-19,17,-13,20,49,6,16,-9,2,-12,52,-8,6,40,9,-25,13,9,28,-30,19,-25,-18,26,15,3,3,-38,-19,-12,15,-15,-22,9,-44,-1,-20,-8},
+        {-60,-18,44,-5,-6,8,26,-13,-20,14,-47,22,22,2,-38,8,-51,18,-50,-30,-25,-11,45,-15,14,12,9,54,-59,9,-14,13,-46,-62,-62,-1,-13,-34,8,27,-48,45,8,19,60,48,-31,-8,-33,58,18,17,22,18,-13,4,47,-11,-14,-32,28,4,31,0},
+        {-15,-5,-50,-34,-18,29,-54,-11,42,5,40,14,37,-28,14,-10,35,18,-4,35,9,-2,5,-4,-7,-26,17,50,-18,33,19,8,7,16,-30,-13,19,-33,-4,27,38,10,-12,-10,-14,32,-120,65,0,0,30,-62,-7,-16,9,-21,7,-3,13,-30,-19,53,-9,29},
+        {-2,-5,15,-24,9,15,9,17,16,-12,-52,34,23,-13,-4,-10,-43,19,-16,-19,25,-3,32,-47,-66,4,-92,20,-39,-66,-25,22,-31,-13,-61,14,-52,-19,55,-18,-47,-18,26,14,-81,0,80,16,-104,-8,12,6,-24,-11,41,0,-3,-8,-1,7,-13,3,-55,36},
+        {5,-22,22,-7,18,-25,6,15,1,-17,-12,17,67,-30,-1,-40,-3,14,26,-47,-11,7,18,0,-23,-13,-16,47,48,-10,-1,-20,7,-3,-19,28,31,-57,-41,-15,-32,-5,12,16,1,11,-40,31,29,-2,-24,-2,35,4,-17,46,-19,-23,-2,57,11,-21,62,13},
+        {-13,-5,23,-11,-14,-6,-9,-66,4,0,-8,19,28,-1,70,-14,-7,-63,3,-8,-11,31,9,30,18,47,-4,25,28,-3,-19,-15,-29,-3,-16,6,-59,-24,35,-35,-20,31,-56,-9,26,-36,25,-1,4,3,22,-7,47,44,36,0,-51,-97,-31,2,-18,13,61,28},
+        {-31,8,24,-1,23,-7,-23,-6,15,-2,-18,-1,23,39,-10,-6,12,-31,-2,12,36,72,1,-14,-7,4,-32,1,-7,-7,57,11,4,-18,-16,5,77,17,18,-8,-17,0,-12,18,-14,-47,3,0,0,0,-2,-21,15,6,20,-19,-15,-20,18,-1,-23,14,14,3},
+        {-19,-53,53,-27,1,-22,57,-20,27,15,44,-22,84,28,12,33,-37,34,-42,29,39,-70,34,15,14,-21,5,-30,-13,14,-55,-8,21,-18,-21,8,-76,-51,46,-7,-27,21,-27,15,22,-23,-58,-15,-14,30,-7,-15,9,-7,-13,44,-21,-50,-12,-5,0,-33,-18,-10},
+        {-23,-43,-11,11,-183,18,46,26,-11,-10,3,-15,-1,5,-14,7,-28,-10,23,-10,9,82,36,24,-24,31,-8,-47,-17,2,68,-6,50,1,-12,4,88,17,28,-55,3,-11,-41,0,-23,30,-35,-10,7,23,22,-22,-11,35,1,-17,-7,-23,-3,31,-5,-14,-4,9},
+        {0,-89,29,2,3,-1,-21,-2,10,0,22,3,3,-34,-29,30,-4,-49,33,24,33,-70,-12,-23,-16,16,-1,39,-39,-3,-47,6,8,-8,27,43,-90,-47,-2,5,13,-33,30,-17,-59,31,96,-17,-53,-33,-18,-36,38,-9,-7,8,-2,-6,15,15,29,-13,1,-3},
+        {-6,17,28,-23,-21,21,17,-4,-56,-61,66,11,-42,-15,-5,-37,13,16,8,1,44,70,-26,63,12,-15,-6,28,16,-49,35,-16,29,-41,-17,10,79,24,8,43,-27,13,47,15,1,27,2,5,34,11,8,-5,21,-60,-1,0,-19,-12,-1,3,26,-21,13,39},
+        {-11,-33,0,33,23,-11,22,11,-11,-1,-26,69,-2,-16,33,-14,18,15,-4,79,1,-97,-9,-1,25,15,-24,23,-36,-4,-38,-4,-76,12,-15,-27,-96,-48,25,-1,-33,-97,-25,-6,23,-8,-59,9,10,32,-48,-2,-32,3,-13,-68,18,6,-25,-13,8,7,-69,-10},
+        {-3,-26,12,24,19,37,-41,7,-19,7,-38,23,-6,-37,-30,-16,-21,-15,4,2,22,67,-10,-7,16,6,-58,2,-51,-6,58,-7,97,34,-12,13,108,66,5,-44,31,31,46,28,2,-11,-3,-34,19,16,14,-21,-9,14,34,24,42,-51,-4,34,22,14,11,3},
+    };
+
+    alignas(32) static constexpr int16_t feature_bias[HIDDEN] = {-4,-33,93,20,23,41,-33,4,48,39,34,47,2,58,54,-13,-9,83,93,3,9,28,65,-16,48,42,7,18,67,0,20,11,35,-31,52,12,-8,-18,87,14,-25,-21,6,57,2,29,-1,56,91,47,1,-39,60,-31,13,12,41,62,-69,20,-9,-7,26,9};
+
+    alignas(32) static constexpr int8_t output_weights[2 * HIDDEN] = {-68,-38,-46,-33,77,-41,38,41,-37,48,-38,38,31,-36,38,45,-37,-46,49,30,37,-24,-46,54,33,36,35,55,38,51,43,-54,-38,-78,-34,43,-127,-47,-48,34,-52,-40,-33,44,-36,-26,55,-39,-34,36,45,-107,38,-47,-42,-40,-35,78,-52,-70,-66,-74,-39,40,65,33,52,33,-97,45,-37,-41,36,-48,38,-43,-32,37,-39,-54,34,44,-50,-31,-37,-127,53,-57,-40,-34,-39,-57,-40,-57,77,51,40,77,28,-43,-106,58,53,-36,41,46,35,-44,37,29,-56,38,41,-34,-42,91,-44,51,42,44,34,-69,55,69,64,78,39,-46};
+
+    static constexpr int32_t output_bias = -75;
+};
+
+#endif // FOUR_IN_A_ROW_NNUE_WEIGHTS_H
@@ -0,0 +1,363 @@
+// FourInARow_Solver.h
+// Bitboard position and exact (perfect-play) solver for the 6x7 Four-in-a-Row board
+
+#ifndef FOUR_IN_A_ROW_SOLVER_H
+#define FOUR_IN_A_ROW_SOLVER_H
+
+#include "BoardGame_Classes.h"
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief 6x7 Four-in-a-Row position packed into two 64-bit words.
+ *
+ * Columns are stored one after another, 7 bits each: bit col * 7 + h is the
+ * cell h rows above the floor of column col. The 7th bit of every column is
+ * a guard that is never set, so shifted lines can't wrap between columns.
+ *
+ * Only the stones of the side to move (current) and all stones (mask) are
+ * kept; the opponent's stones are current ^ mask. Playing a move flips the
+ * point of view, so the same code serves both sides.
+ */
+class FourInARow_Position {
+public:
+    static const int WIDTH = 7;  ///< Number of columns
+    static const int HEIGHT = 6; ///< Number of rows
+
+    /// Floor of every column: the geometric series sum of 2^(col * (HEIGHT + 1))
+    static constexpr uint64_t BOTTOM_MASK =
+        ((uint64_t(1) << (WIDTH * (HEIGHT + 1))) - 1) / ((uint64_t(1) << (HEIGHT + 1)) - 1);
+    /// Every playable cell (all but the guard bit of each column)
+    static constexpr uint64_t BOARD_MASK = BOTTOM_MASK * ((uint64_t(1) << HEIGHT) - 1);
+
+private:
+    uint64_t current = 0; ///< Stones of the side to move
+    uint64_t mask = 0;    ///< Every stone on the board
+    int moves = 0;        ///< Stones played so far
+
+    /**
+     * @brief Empty cells that would complete a line of four for position.
+     *
+     * For each direction, ORs together the cells that sit at the end of, or
+     * inside the gap of, three aligned stones.
+     */
+    static uint64_t compute_winning_position(uint64_t position, uint64_t mask) {
+        // Vertical: three stones directly below
+        uint64_t r = (position << 1) & (position << 2) & (position << 3);
+
+        const int shifts[3] = { HEIGHT + 1, HEIGHT, HEIGHT + 2 }; // horizontal and both diagonals
+        for (int s : shifts) {
+            uint64_t p = (position << s) & (position << 2 * s);
+            r |= p & (position << 3 * s);
+            r |= p & (position >> s);
+            p = (position >> s) & (position >> 2 * s);
+            r |= p & (position << s);
+            r |= p & (position >> 3 * s);
+        }
+
+        return r & (BOARD_MASK ^ mask);
+    }
+
+public:
+    /**
+     * @brief Build a position from a 6x7 grid where row 0 is the top.
+     * @param board Cells to read (' ' is empty)
+     * @param to_move Symbol of the side to move
+     */
+    static FourInARow_Position from_view(const BoardView<char>& board, char to_move) {
+        FourInARow_Position pos;
+        for (int col = 0; col < WIDTH; col++) {
+            for (int h = 0; h < HEIGHT; h++) {
+                char c = board[HEIGHT - 1 - h][col];
+                if (c == ' ') break;
+                uint64_t b = uint64_t(1) << (col * (HEIGHT + 1) + h);
+                pos.mask |= b;
+                if (c == to_move) pos.current |= b;
+                pos.moves++;
+            }
+        }
+        return pos;
+    }
+
+    /** @brief Mask of every cell of column col. */
+    static uint64_t column_mask(int col) {
+        return ((uint64_t(1) << HEIGHT) - 1) << (col * (HEIGHT + 1));
+    }
+
+    /** @brief Check if the stones in position contain a line of four. */
+    static bool alignment(uint64_t position) {
+        const int shifts[4] = { 1, HEIGHT + 1, HEIGHT, HEIGHT + 2 };
+        for (int s : shifts) {
+            uint64_t m = position & (position >> s);
+            if (m & (m >> 2 * s)) return true;
+        }
+        return false;
+    }
+
+    /** @brief Stones of the side to move. */
+    uint64_t get_current() const { return current; }
+
+    /** @brief Stones of the side that just moved. */
+    uint64_t get_opponent() const { return current ^ mask; }
+
+    /** @brief Every stone on the board. */
+    uint64_t get_mask() const { return mask; }
+
+    /** @brief Number of stones played. */
+    int nb_moves() const { return moves; }
+
+    /** @brief Unique key of the position (current + mask never collides). */
+    uint64_t key() const { return current + mask; }
+
+    /**
+     * @brief Reflect a board-shaped bit set left to right.
+     *
+     * Works on keys too: each column of current + mask stays inside its own
+     * 7 bits, so columns can be swapped independently.
+     */
+    static uint64_t mirror(uint64_t bits) {
+        uint64_t r = 0;
+        for (int col = 0; col < WIDTH; col++)
+            r |= ((bits >> (col * (HEIGHT + 1))) & 0x7F) << ((WIDTH - 1 - col) * (HEIGHT + 1));
+        return r;
+    }
+
+    /**
+     * @brief Key shared by the position and its mirror image (the smaller one)
+     * @param mirrored Set if the key is the mirror image's, so columns must be flipped
+     */
+    uint64_t canonical_key(bool& mirrored) const {
+        uint64_t k = key();
+        uint64_t flipped = mirror(k);
+        mirrored = flipped < k;
+        return mirrored ? flipped : k;
+    }
+
+    /** @brief Cells where a stone can be dropped right now, one per open column. */
+    uint64_t possible() const { return (mask + BOTTOM_MASK) & BOARD_MASK; }
+
+    /** @brief Check if column col still has room. */
+    bool can_play(int col) const { return (possible() & column_mask(col)) != 0; }
+
+    /** @brief Drop a stone for the side to move on the single-bit move. */
+    void play(uint64_t move) {
+        current ^= mask;
+        mask |= move;
+        moves++;
+    }
+
+    /** @brief Drop a stone for the side to move into column col. */
+    void play_column(int col) { play(possible() & column_mask(col)); }
+
+    /** @brief Take back move, the last stone played (inverse of play()). */
+    void undo(uint64_t move) {
+        mask ^= move;
+        current ^= mask;
+        moves--;
+    }
+
+    /** @brief Empty cells that would win for the side to move. */
+    uint64_t winning_position() const { return compute_winning_position(current, mask); }
+
+    /** @brief Empty cells that would win for the opponent. */
+    uint64_t opponent_winning_position() const { return compute_winning_position(current ^ mask, mask); }
+
+    /** @brief Check if the side to move can win with its next stone. */
+    bool can_win_next() const { return (winning_position() & possible()) != 0; }
+
+    /** @brief Check if dropping into column col wins at once. */
+    bool is_winning_move(int col) const {
+        return (winning_position() & possible() & column_mask(col)) != 0;
+    }
+
+    /**
+     * @brief Playable cells that don't hand the opponent an immediate win.
+     *
+     * Assumes the side to move can't win at once. If the opponent threatens
+     * two cells the result is 0: every move loses.
+     */
+    uint64_t possible_non_losing_moves() const {
+        uint64_t possible_mask = possible();
+        uint64_t opponent_win = opponent_winning_position();
+        uint64_t forced = possible_mask & opponent_win;
+        if (forced) {
+            if (forced & (forced - 1)) return 0;
+            possible_mask = forced;
+        }
+        // Never play directly below a cell the opponent wins on
+        return possible_mask & ~(opponent_win >> 1);
+    }
+
+    /** @brief Number of winning cells the side to move would have after move. */
+    int move_score(uint64_t move) const {
+        return __builtin_popcountll(compute_winning_position(current | move, mask));
+    }
+};
+
+/**
+ * @brief Exact negamax solver for FourInARow_Position.
+ *
+ * Scores follow the usual convention: positive if the side to move wins,
+ * and larger the sooner it wins (22 minus its stone count at the win),
+ * 0 for a draw. Searches stop once the node budget is spent, which keeps
+ * the worst-case latency of one call fixed.
+ */
+class FourInARow_Solver {
+    static const int WIDTH = FourInARow_Position::WIDTH;
+    static const int HEIGHT = FourInARow_Position::HEIGHT;
+    static const int CELLS = WIDTH * HEIGHT;
+
+    int column_order[WIDTH];       ///< Center-out exploration order
+    unsigned long long nodes = 0;  ///< Nodes visited since the last reset
+    unsigned long long budget = 0; ///< Node limit (0 means unlimited)
+    bool aborted = false;          ///< Set when the budget ran out
+
+    /**
+     * @brief Fail-soft alpha-beta on the exact score.
+     *
+     * Expects that the side to move can't win with its next stone.
+     */
+    int negamax(const FourInARow_Position& pos, int alpha, int beta) {
+        if (++nodes > budget && budget) {
+            aborted = true;
+            return 0;
+        }
+
+        uint64_t next = pos.possible_non_losing_moves();
+        if (next == 0) return -(CELLS - pos.nb_moves()) / 2; // Opponent wins next turn
+        if (pos.nb_moves() >= CELLS - 2) return 0;             // Nobody can win any more
+
+        // Tighten the window with the best and worst reachable scores
+        int min = -(CELLS - 2 - pos.nb_moves()) / 2;
+        if (alpha < min) {
+            alpha = min;
+            if (alpha >= beta) return alpha;
+        }
+        int max = (CELLS - 1 - pos.nb_moves()) / 2;
+        if (beta > max) {
+            beta = max;
+            if (alpha >= beta) return beta;
+        }
+
+        // Try moves that create the most threats first, ties center-out
+        uint64_t order[WIDTH];
+        int scores[WIDTH];
+        int count = 0;
+        for (int i = WIDTH - 1; i >= 0; i--) {
+            uint64_t move = next & FourInARow_Position::column_mask(column_order[i]);
+            if (!move) continue;
+            int score = pos.move_score(move);
+            int j = count++;
+            for (; j && scores[j - 1] > score; j--) {
+                order[j] = order[j - 1];
+                scores[j] = scores[j - 1];
+            }
+            order[j] = move;
+            scores[j] = score;
+        }
+
+        for (int i = count - 1; i >= 0; i--) {
+            FourInARow_Position child = pos;
+            child.play(order[i]);
+            int score = -negamax(child, -beta, -alpha);
+            if (aborted) return 0;
+            if (score >= beta) return score;
+            if (score > alpha) alpha = score;
+        }
+        return alpha;
+    }
+
+    /**
+     * @brief Exact score of pos, charging nodes to the running count.
+     * @return false if the node budget ran out first
+     */
+    bool run(const FourInARow_Position& pos, int& score) {
+        if (pos.can_win_next()) {
+            score = win_score(pos.nb_moves());
+            return true;
+        }
+
+        // Narrow [min, max] with null-window probes, biased toward 0
+        int min = -(CELLS - pos.nb_moves()) / 2;
+        int max = (CELLS + 1 - pos.nb_moves()) / 2;
+        while (min < max) {
+            int med = min + (max - min) / 2;
+            if (med <= 0 && min / 2 < med) med = min / 2;
+            else if (med >= 0 && max / 2 > med) med = max / 2;
+            int r = negamax(pos, med, med + 1);
+            if (aborted) return false;
+            if (r <= med) max = r;
+            else min = r;
+        }
+        score = min;
+        return true;
+    }
+
+public:
+    /** @brief Score of a position with moves_played stones where the side to move wins at once. */
+    static int win_score(int moves_played) { return (CELLS + 1 - moves_played) / 2; }
+
+    /**
+     * @brief Construct a solver with an optional node budget.
+     * @param node_budget Nodes per call before it gives up (0 = no limit)
+     */
+    explicit FourInARow_Solver(unsigned long long node_budget = 0) : budget(node_budget) {
+        for (int i = 0; i < WIDTH; i++)
+            column_order[i] = WIDTH / 2 + (1 - 2 * (i % 2)) * (i + 1) / 2;
+    }
+
+    /** @brief Nodes visited by the last call. */
+    unsigned long long get_nodes() const { return nodes; }
+
+    /**
+     * @brief Compute the exact score of pos.
+     * @param pos Position to solve
+     * @param score Set to the exact score on success
+     * @return false if the node budget ran out first
+     */
+    bool solve(const FourInARow_Position& pos, int& score) {
+        nodes = 0;
+        aborted = false;
+        return run(pos, score);
+    }
+
+    /**
+     * @brief Pick the column with the best exact score.
+     * @param pos Position with at least one open column
+     * @param col Set to the chosen column on success
+     * @param score Set to that column's score for the side to move
+     * @return false if the node budget ran out first
+     */
+    bool best_column(const FourInARow_Position& pos, int& col, int& score) {
+        nodes = 0;
+        aborted = false;
+        int best_col = -1;
+        int best_score = -CELLS;
+
+        for (int i = 0; i < WIDTH; i++) {
+            int c = column_order[i];
+            if (!pos.can_play(c)) continue;
+            if (pos.is_winning_move(c)) {
+                col = c;
+                score = win_score(pos.nb_moves());
+                return true;
+            }
+
+            FourInARow_Position child = pos;
+            child.play_column(c);
+            int child_score;
+            if (!run(child, child_score)) return false;
+            if (-child_score > best_score) {
+                best_score = -child_score;
+                best_col = c;
+            }
+        }
+
+        col = best_col;
+        score = best_score;
+        return best_col >= 0;
+    }
+};
+
+#endif // FOUR_IN_A_ROW_SOLVER_H
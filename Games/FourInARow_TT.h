@@ -0,0 +1,140 @@
+// FourInARow_TT.h
+// Transposition table for the Four-in-a-Row search, shared by mirror-image positions
+
+#ifndef FOUR_IN_A_ROW_TT_H
+#define FOUR_IN_A_ROW_TT_H
+
+#include "FourInARow_Solver.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+using namespace std;
+
+/**
+ * @brief Fixed-size, power-of-two transposition table keyed by position.
+ *
+ * A position and its left-right mirror image have the same value, so both
+ * are stored under the smaller of their two keys, and the best column is
+ * flipped on the way in and out. Each slot keeps the full key, so a probe
+ * never returns another position's entry. A new result replaces the slot
+ * unless the slot holds the same position searched deeper.
+ *
+ * Search threads share one table without locks: a slot is two atomic
+ * words, the packed entry and key ^ entry. A slot torn by two threads
+ * writing at once no longer matches its key, so it reads as a miss.
+ */
+class FourInARow_TT {
+public:
+    /** @brief What the stored score says about the true value. */
+    enum Bound : uint8_t {
+        NONE = 0,  ///< Empty slot
+        EXACT,     ///< Score is the value
+        LOWER,     ///< Value is at least score (search failed high)
+        UPPER      ///< Value is at most score (search failed low)
+    };
+
+    /** @brief One table entry, as returned by probe(). */
+    struct Entry {
+        uint64_t key = 0;    ///< Canonical position key
+        int32_t score = 0;   ///< Stored score
+        int8_t depth = 0;    ///< Remaining depth the score was searched to
+        Bound bound = NONE;  ///< How to read score
+        int8_t best_col = -1; ///< Best column found, -1 if none
+    };
+
+private:
+    /** @brief Two words written and read independently; see the class notes. */
+    struct Slot {
+        atomic<uint64_t> check{0}; ///< key ^ data
+        atomic<uint64_t> data{0};  ///< Packed entry, 0 when empty
+    };
+
+    unique_ptr<Slot[]> slots;
+    int shift; ///< 64 - log2(size): keeps the top bits of the hashed key
+
+    /** @brief Pack score, depth, bound and best column into one word. */
+    static uint64_t pack(int score, int depth, Bound bound, int best_col) {
+        return uint64_t(uint32_t(score)) |
+               uint64_t(uint8_t(depth)) << 32 |
+               uint64_t(bound) << 40 |
+               uint64_t(uint8_t(best_col)) << 48;
+    }
+
+    /** @brief Inverse of pack(); the key is filled in by the caller. */
+    static Entry unpack(uint64_t data) {
+        Entry e;
+        e.score = int32_t(uint32_t(data));
+        e.depth = int8_t(data >> 32);
+        e.bound = Bound(uint8_t(data >> 40));
+        e.best_col = int8_t(data >> 48);
+        return e;
+    }
+
+    /** @brief Slot for a canonical key (Fibonacci hashing spreads the sparse keys). */
+    Slot& slot(uint64_t key) {
+        return slots[(key * 0x9E3779B97F4A7C15ULL) >> shift];
+    }
+
+    /** @brief Read a slot; false if it is empty, torn, or holds another key. */
+    static bool read(const Slot& s, uint64_t key, uint64_t& data) {
+        data = s.data.load(memory_order_relaxed);
+        return data != 0 && (s.check.load(memory_order_relaxed) ^ data) == key;
+    }
+
+public:
+    /**
+     * @brief Allocate a table of 2^size_bits entries (done once, up front).
+     */
+    explicit FourInARow_TT(int size_bits = 18)
+        : slots(new Slot[size_t(1) << size_bits]), shift(64 - size_bits) {}
+
+    /** @brief Forget every stored position (not while a search is running). */
+    void clear() {
+        for (size_t i = 0, n = size_t(1) << (64 - shift); i < n; i++) {
+            slots[i].check.store(0, memory_order_relaxed);
+            slots[i].data.store(0, memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Look up pos.
+     * @param pos Position to find
+     * @param out Filled with the entry, best column in pos's own orientation
+     * @return true if pos (or its mirror image) is stored
+     */
+    bool probe(const FourInARow_Position& pos, Entry& out) {
+        bool mirrored;
+        uint64_t key = pos.canonical_key(mirrored);
+        uint64_t data;
+        if (!read(slot(key), key, data)) return false;
+        out = unpack(data);
+        out.key = key;
+        if (mirrored && out.best_col >= 0)
+            out.best_col = FourInARow_Position::WIDTH - 1 - out.best_col;
+        return true;
+    }
+
+    /**
+     * @brief Store a search result for pos.
+     * @param pos Searched position
+     * @param score Score found
+     * @param depth Remaining depth of the search
+     * @param bound How score relates to the true value
+     * @param best_col Best column found in pos's own orientation, or -1
+     */
+    void store(const FourInARow_Position& pos, int score, int depth, Bound bound, int best_col) {
+        bool mirrored;
+        uint64_t key = pos.canonical_key(mirrored);
+        Slot& s = slot(key);
+        uint64_t old;
+        if (read(s, key, old) && unpack(old).depth > depth) return;
+
+        if (mirrored && best_col >= 0) best_col = FourInARow_Position::WIDTH - 1 - best_col;
+        uint64_t data = pack(score, depth, bound, best_col);
+        s.check.store(key ^ data, memory_order_relaxed);
+        s.data.store(data, memory_order_relaxed);
+    }
+};
+
+#endif // FOUR_IN_A_ROW_TT_H
@@ -6,66 +6,33 @@ using namespace std;
 
 // ==================== Memory_Board Implementation ====================
 
-Memory_Board::Memory_Board() : Board(3, 3) {
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+Memory_Board::Memory_Board() : BitBoard_Board(3, 3) {
+    fill_cells(blank_symbol);
 }
 
-bool Memory_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char mark = move->get_symbol();
+bool Memory_Board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char mark = move.get_symbol();
 
     if (x < 0 || x >= rows || y < 0 || y >= columns) {
-        cout << "Invalid position! Please choose between (0-2, 0-2)\n";
+        if (!quiet) cout << "Invalid position! Please choose between (0-2, 0-2)\n";
         return false;
     }
 
     if (board[x][y] != blank_symbol) {
-        cout << "Cell is already occupied! Choose another cell.\n";
+        if (!quiet) cout << "Cell is already occupied! Choose another cell.\n";
         return false;
     }
 
-    board[x][y] = mark;
+    set_cell(x, y, mark);
     n_moves++;
     return true;
 }
 
 bool Memory_Board::has_three_in_row(char symbol) {
-    // Check rows
-    for (int i = 0; i < rows; i++) {
-        if (board[i][0] == symbol &&
-            board[i][1] == symbol &&
-            board[i][2] == symbol) {
-            return true;
-        }
-    }
-
-    // Check columns
-    for (int j = 0; j < columns; j++) {
-        if (board[0][j] == symbol &&
-            board[1][j] == symbol &&
-            board[2][j] == symbol) {
-            return true;
-        }
-    }
-
-    // Check main diagonal
-    if (board[0][0] == symbol &&
-        board[1][1] == symbol &&
-        board[2][2] == symbol) {
-        return true;
-    }
-
-    // Check anti-diagonal
-    if (board[0][2] == symbol &&
-        board[1][1] == symbol &&
-        board[2][0] == symbol) {
-        return true;
-    }
-
-    return false;
+    // Rows, columns and both diagonals in one shift-and-AND pass
+    return has_line(symbol, 3);
 }
 
 bool Memory_Board::is_win(Player<char>* player) {
@@ -86,22 +53,31 @@ bool Memory_Board::game_is_over(Player<char>* player) {
     return has_three_in_row('X') || has_three_in_row('O') || (n_moves >= 9);
 }
 
+GameOutcome Memory_Board::outcome_after(const Move<char>& last_move) {
+    if (has_line_through(last_move.get_symbol(), last_move.get_x(), last_move.get_y(), 3))
+        return GameOutcome::WIN;
+    return n_moves >= 9 ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void Memory_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    add_empty_cells(player->get_symbol(), moves);
+}
+
 // ==================== Fake_Board Implementation ====================
 
 Fake_Board::Fake_Board() : Board(3, 3) {
     // Initialize all cells with blank (space)
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = ' ';  // Start blank
+    fill_cells(' ');
 }
 
-bool Fake_Board::update_board(Move<char>* move) {
+bool Fake_Board::update_board(const Move<char>& move) {
     // When a move is made, show '?' instead of the actual symbol
-    int x = move->get_x();
-    int y = move->get_y();
+    int x = move.get_x();
+    int y = move.get_y();
 
     if (x >= 0 && x < rows && y >= 0 && y < columns) {
-        board[x][y] = '?';  // Show '?' for any move
+        set_cell(x, y, '?');  // Show '?' for any move
         n_moves++;
         return true;
     }
@@ -124,6 +100,14 @@ bool Fake_Board::game_is_over(Player<char>*) {
     return false;
 }
 
+void Fake_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < rows; i++)
+        for (int j = 0; j < columns; j++)
+            if (board[i][j] == ' ')
+                moves.push_back(Move<char>(i, j, player->get_symbol()));
+}
+
 // ==================== Memory_UI Implementation ====================
 
 Memory_UI::Memory_UI() : ValidatedUI<char>(
@@ -137,7 +121,7 @@ Player<char>* Memory_UI::create_player(string& name, char symbol, PlayerType typ
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Memory_UI::get_move(Player<char>* player) {
+Move<char> Memory_UI::get_move(Player<char>* player) {
     int x, y;
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -161,5 +145,5 @@ Move<char>* Memory_UI::get_move(Player<char>* player) {
              << ") plays at: " << x << " " << y << endl;
     }
 
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
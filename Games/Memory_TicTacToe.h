@@ -3,6 +3,7 @@
 
 #include "BoardGame_Classes.h"
 #include "ValidatedUI.h"
+#include "BitBoard.h"
 #include <string>
 
 using namespace std;
@@ -17,25 +18,28 @@ private:
 
 public:
     Fake_Board();
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
     bool is_win(Player<char>*) override;
     bool is_lose(Player<char>*) override;
     bool is_draw(Player<char>*) override;
     bool game_is_over(Player<char>*) override;
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
 };
 
-class Memory_Board : public Board<char> {
+class Memory_Board : public BitBoard_Board {
 private:
     char blank_symbol = ' ';
     bool has_three_in_row(char symbol);
 
 public:
     Memory_Board();
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
     bool is_win(Player<char>* player) override;
     bool is_lose(Player<char>* player) override;
     bool is_draw(Player<char>* player) override;
     bool game_is_over(Player<char>* player) override;
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
 };
 
 class Memory_UI : public ValidatedUI<char> {
@@ -43,7 +47,7 @@ public:
     Memory_UI();
     ~Memory_UI() {}
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 };
 
 #endif
@@ -6,70 +6,37 @@ using namespace std;
 
 //--------------------------------------- Misere_Board Implementation
 
-Misere_Board::Misere_Board() : Board(3, 3) {
+Misere_Board::Misere_Board() : BitBoard_Board(3, 3) {
     // Initialize all cells with blank_symbol
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+    fill_cells(blank_symbol);
 }
 
-bool Misere_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char mark = move->get_symbol();
+bool Misere_Board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char mark = move.get_symbol();
 
     // Validate move position
     if (x < 0 || x >= rows || y < 0 || y >= columns) {
-        cout << "Invalid position! Please choose between (0-2, 0-2)\n";
+        if (!quiet) cout << "Invalid position! Please choose between (0-2, 0-2)\n";
         return false;
     }
 
     // Check if cell is empty
     if (board[x][y] != blank_symbol) {
-        cout << "Cell is already occupied! Choose another cell.\n";
+        if (!quiet) cout << "Cell is already occupied! Choose another cell.\n";
         return false;
     }
 
     // Place the mark
-    board[x][y] = mark;
+    set_cell(x, y, mark);
     n_moves++;
     return true;
 }
 
 bool Misere_Board::has_three_in_row(char symbol) {
-    // Check rows
-    for (int i = 0; i < rows; i++) {
-        if (board[i][0] == symbol &&
-            board[i][1] == symbol &&
-            board[i][2] == symbol) {
-            return true;
-        }
-    }
-
-    // Check columns
-    for (int j = 0; j < columns; j++) {
-        if (board[0][j] == symbol &&
-            board[1][j] == symbol &&
-            board[2][j] == symbol) {
-            return true;
-        }
-    }
-
-    // Check main diagonal (top-left to bottom-right)
-    if (board[0][0] == symbol &&
-        board[1][1] == symbol &&
-        board[2][2] == symbol) {
-        return true;
-    }
-
-    // Check anti-diagonal (top-right to bottom-left)
-    if (board[0][2] == symbol &&
-        board[1][1] == symbol &&
-        board[2][0] == symbol) {
-        return true;
-    }
-
-    return false;
+    // Rows, columns and both diagonals in one shift-and-AND pass
+    return has_line(symbol, 3);
 }
 
 bool Misere_Board::is_win(Player<char>* player) {
@@ -95,6 +62,18 @@ bool Misere_Board::game_is_over(Player<char>* player) {
     return has_three_in_row('X') || has_three_in_row('O') || (n_moves >= 9);
 }
 
+GameOutcome Misere_Board::outcome_after(const Move<char>& last_move) {
+    // Completing a line through your own mark loses
+    if (has_line_through(last_move.get_symbol(), last_move.get_x(), last_move.get_y(), 3))
+        return GameOutcome::LOSS;
+    return n_moves >= 9 ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void Misere_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    add_empty_cells(player->get_symbol(), moves);
+}
+
 //--------------------------------------- Misere_UI Implementation
 
 Misere_UI::Misere_UI() : ValidatedUI<char>(
@@ -109,7 +88,7 @@ Player<char>* Misere_UI::create_player(string& name, char symbol, PlayerType typ
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Misere_UI::get_move(Player<char>* player) {
+Move<char> Misere_UI::get_move(Player<char>* player) {
     int x, y;
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -136,5 +115,5 @@ Move<char>* Misere_UI::get_move(Player<char>* player) {
              << ") plays at: " << x << " " << y << endl;
     }
 
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
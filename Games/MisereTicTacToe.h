@@ -10,6 +10,7 @@
 
 #include "BoardGame_Classes.h"
 #include "ValidatedUI.h"
+#include "BitBoard.h"
 #include <string>
 
 using namespace std;
@@ -20,7 +21,7 @@ using namespace std;
  *
  * In this variant, getting three-in-a-row means you LOSE!
  */
-class Misere_Board : public Board<char> {
+class Misere_Board : public BitBoard_Board {
 private:
     char blank_symbol = ' '; ///< Character for empty cell
 
@@ -42,7 +43,7 @@ public:
      * @param move The move containing position and symbol
      * @return true if move is valid, false otherwise
      */
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
 
     /**
      * @brief Check if player has WON
@@ -74,6 +75,18 @@ public:
      * @return true if someone got three-in-a-row or board is full
      */
     bool game_is_over(Player<char>* player) override;
+
+    /**
+     * @brief Decide the game from the lines through the last move only.
+     * @param last_move The move that was just applied.
+     * @return LOSS if the new mark completes three in a row, DRAW on a full board
+     */
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+
+    /**
+     * @brief List every empty cell as a move for the player
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
 };
 
 /**
@@ -106,7 +119,7 @@ public:
      * @param player The player making the move
      * @return Move object with position and symbol
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 };
 
 #endif // MISERE_TICTACTOE_H
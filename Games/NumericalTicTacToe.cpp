@@ -5,37 +5,32 @@
 
 using namespace std;
 
-Numerical_Board::Numerical_Board() : Board(3, 3) {
+Numerical_Board::Numerical_Board() : FixedBoard() {
 
-    for (auto& row : board) {
-        for (auto& cell : row) {
-            cell = blank_value;
-        }
-    }
+    fill_cells(blank_value);
 }
 
-bool Numerical_Board::update_board(Move<int>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    int number = move->get_symbol();
+bool Numerical_Board::update_board(const Move<int>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    int number = move.get_symbol();
 
     if (x < 0 || x >= rows || y < 0 || y >= columns) {
-        cout << "Invalid position! Row and column must be between 0 and 2.\n";
+        if (!quiet) cout << "Invalid position! Row and column must be between 0 and 2.\n";
         return false;
     }
 
     if (board[x][y] != blank_value) {
-        cout << "Cell already occupied!\n";
+        if (!quiet) cout << "Cell already occupied!\n";
         return false;
     }
 
-    if (used_numbers.count(number)) {
-        cout << "Number " << number << " has already been used!\n";
+    if (is_number_used(number)) {
+        if (!quiet) cout << "Number " << number << " has already been used!\n";
         return false;
     }
 
-    board[x][y] = number;
-    used_numbers.insert(number);
+    set_cell(x, y, number);
     n_moves++;
     
     return true;
@@ -43,38 +38,38 @@ bool Numerical_Board::update_board(Move<int>* move) {
 
 bool Numerical_Board::is_win(Player<int>* player) {
 
-    for (int i = 0; i < rows; ++i) {
-        if (board[i][0] != blank_value && 
-            board[i][1] != blank_value && 
-            board[i][2] != blank_value) {
-            if (board[i][0] + board[i][1] + board[i][2] == 15) {
+    for (int i = 0; i < ROWS; ++i) {
+        if (at(i, 0) != blank_value && 
+            at(i, 1) != blank_value && 
+            at(i, 2) != blank_value) {
+            if (at(i, 0) + at(i, 1) + at(i, 2) == 15) {
                 return true;
             }
         }
     }
 
-    for (int j = 0; j < columns; ++j) {
-        if (board[0][j] != blank_value && 
-            board[1][j] != blank_value && 
-            board[2][j] != blank_value) {
-            if (board[0][j] + board[1][j] + board[2][j] == 15) {
+    for (int j = 0; j < COLUMNS; ++j) {
+        if (at(0, j) != blank_value && 
+            at(1, j) != blank_value && 
+            at(2, j) != blank_value) {
+            if (at(0, j) + at(1, j) + at(2, j) == 15) {
                 return true;
             }
         }
     }
 
-    if (board[0][0] != blank_value && 
-        board[1][1] != blank_value && 
-        board[2][2] != blank_value) {
-        if (board[0][0] + board[1][1] + board[2][2] == 15) {
+    if (at(0, 0) != blank_value && 
+        at(1, 1) != blank_value && 
+        at(2, 2) != blank_value) {
+        if (at(0, 0) + at(1, 1) + at(2, 2) == 15) {
             return true;
         }
     }
 
-    if (board[0][2] != blank_value && 
-        board[1][1] != blank_value && 
-        board[2][0] != blank_value) {
-        if (board[0][2] + board[1][1] + board[2][0] == 15) {
+    if (at(0, 2) != blank_value && 
+        at(1, 1) != blank_value && 
+        at(2, 0) != blank_value) {
+        if (at(0, 2) + at(1, 1) + at(2, 0) == 15) {
             return true;
         }
     }
@@ -90,8 +85,45 @@ bool Numerical_Board::game_is_over(Player<int>* player) {
     return is_win(player) || is_draw(player);
 }
 
+GameOutcome Numerical_Board::outcome_after(const Move<int>& last_move) {
+    int x = last_move.get_x();
+    int y = last_move.get_y();
+
+    // Sum of a full line, or 0 if any of its cells is still blank
+    auto line_sum = [&](int r, int c, int dr, int dc) {
+        int sum = 0;
+        for (int i = 0; i < 3; ++i) {
+            int value = at(r + i * dr, c + i * dc);
+            if (value == blank_value) return 0;
+            sum += value;
+        }
+        return sum;
+    };
+
+    if (line_sum(x, 0, 0, 1) == 15 || line_sum(0, y, 1, 0) == 15 ||
+        (x == y && line_sum(0, 0, 1, 1) == 15) ||
+        (x + y == 2 && line_sum(0, 2, 1, -1) == 15)) {
+        return GameOutcome::WIN;
+    }
+    return n_moves == 9 ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void Numerical_Board::generate_moves(Player<int>* player, MoveList<int>& moves) {
+    // Player 1 owns the odd numbers, player 2 the even ones
+    moves.clear();
+    int first = player->get_symbol() == 1 ? 1 : 2;
+    for (int i = 0; i < ROWS; i++) {
+        for (int j = 0; j < COLUMNS; j++) {
+            if (at(i, j) != blank_value) continue;
+            for (int number = first; number <= 9; number += 2)
+                if (!is_number_used(number))
+                    moves.push_back(Move<int>(i, j, number));
+        }
+    }
+}
+
 bool Numerical_Board::is_number_used(int number) const {
-    return used_numbers.count(number) > 0;
+    return find(board.begin(), board.end(), number) != board.end();
 }
 
 
@@ -124,7 +156,7 @@ Numerical_UI::Numerical_UI()
               "Player 2 uses even numbers (2,4,6,8)\n"
               "Goal: Make three numbers sum to 15 in a row!", 3) {}
 
-Move<int>* Numerical_UI::get_move(Player<int>* player) {
+Move<int> Numerical_UI::get_move(Player<int>* player) {
     int x, y, number;
 
     Numerical_Player* num_player = dynamic_cast<Numerical_Player*>(player);
@@ -165,11 +197,11 @@ Move<int>* Numerical_UI::get_move(Player<int>* player) {
     } else if (player->get_type() == PlayerType::COMPUTER) {
         Numerical_Board* board = dynamic_cast<Numerical_Board*>(player->get_board_ptr());
 
+        BoardView<int> board_view = board->get_board_view();
         vector<pair<int, int>> empty_positions;
         for (int i = 0; i < 3; ++i) {
             for (int j = 0; j < 3; ++j) {
-                auto board_matrix = board->get_board_matrix();
-                if (board_matrix[i][j] == 0) {
+                if (board_view(i, j) == 0) {
                     empty_positions.push_back({i, j});
                 }
             }
@@ -189,7 +221,7 @@ Move<int>* Numerical_UI::get_move(Player<int>* player) {
     }
 
     num_player->use_number(number);
-    return new Move<int>(x, y, number);
+    return Move<int>(x, y, number);
 }
 
 Player<int>* Numerical_UI::create_player(string& name, int symbol, PlayerType type) {
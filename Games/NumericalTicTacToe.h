@@ -18,9 +18,8 @@
  * @class Numerical_Board
  * @brief Board class for Numerical Tic-Tac-Toe
  */
-class Numerical_Board : public Board<int> {
+class Numerical_Board : public FixedBoard<int, 3, 3> {
 private:
-    std::set<int> used_numbers;
     int blank_value = 0;
 
 public:
@@ -34,7 +33,7 @@ public:
      * @param move The move containing position and number
      * @return true if move is valid, false otherwise
      */
-    bool update_board(Move<int>* move) override;
+    bool update_board(const Move<int>& move) override;
 
     /**
      * @brief Check if player has won (three numbers summing to 15)
@@ -64,8 +63,23 @@ public:
      */
     bool game_is_over(Player<int>* player) override;
 
+    /**
+     * @brief Check only the lines through the last placed number
+     * @param last_move The move just applied
+     * @return WIN if one of them sums to 15, DRAW on a full board
+     */
+    GameOutcome outcome_after(const Move<int>& last_move) override;
+
+    /**
+     * @brief List every empty cell paired with every unused number of the player's parity
+     * @param player The player to move (symbol 1 plays odd, 2 plays even)
+     * @param moves Buffer filled with the legal moves
+     */
+    void generate_moves(Player<int>* player, MoveList<int>& moves) override;
+
     /**
      * @brief Check if a number has been used
+     * Read straight from the cells, so it follows unmake_move() with no extra state
      * @param number The number to check
      * @return true if already used
      */
@@ -135,7 +149,7 @@ public:
      * @param player The player making the move
      * @return Move object with position and number
      */
-    Move<int>* get_move(Player<int>* player) override;
+    Move<int> get_move(Player<int>* player) override;
 
     /**
      * @brief Create a player based on type
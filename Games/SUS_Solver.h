@@ -0,0 +1,104 @@
+// SUS_Solver.h
+// Exact minimax solver for the 3x3 SUS game
+
+#ifndef SUS_SOLVER_H
+#define SUS_SOLVER_H
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Position encoding, scoring and exact values for 3x3 SUS.
+ *
+ * A position is the base-3 number of its nine cells, cell r * 3 + c
+ * weighing 3^(r * 3 + c): 0 empty, 1 'S', 2 'U'. Player 1 always places
+ * 'S' and moves first, so 'S' is to move when both letters are equally
+ * many. Whoever completes S-U-S lines scores them, so the rest of the
+ * game is worth the same to the side to move whatever the score is now.
+ *
+ * value() of a position is the best score difference (side to move minus
+ * the other side) still to be made from it with both sides playing
+ * perfectly. tools/SUS_TableBuilder.cpp stores every value in
+ * SUS_Table.h, so the AI never searches.
+ */
+class SUS_Solver {
+public:
+    static const int CELLS = 9;
+    static const int POSITIONS = 19683; ///< 3^9
+    static const int EMPTY = 0, S = 1, U = 2;
+
+    /** @brief The eight S-U-S lines as cell indices; the middle cell needs the 'U'. */
+    static constexpr int LINES[8][3] = {
+        {0, 1, 2}, {3, 4, 5}, {6, 7, 8},
+        {0, 3, 6}, {1, 4, 7}, {2, 5, 8},
+        {0, 4, 8}, {2, 4, 6}
+    };
+
+    /** @brief 3^cell: the place value of a cell in a position index. */
+    static int place(int cell) {
+        static const int POWERS[CELLS] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+        return POWERS[cell];
+    }
+
+    /** @brief Content of cell in position index (EMPTY, S or U). */
+    static int cell_at(int index, int cell) { return index / place(cell) % 3; }
+
+    /** @brief Letter to move in index: 'S' unless it has placed one more. */
+    static int to_move(int index) {
+        int s = 0, u = 0;
+        for (int cell = 0; cell < CELLS; cell++) {
+            int v = cell_at(index, cell);
+            s += v == S;
+            u += v == U;
+        }
+        return s == u ? S : U;
+    }
+
+    /** @brief Lines completed by putting letter on the empty cell of index. */
+    static int gain(int index, int cell, int letter) {
+        int child = index + letter * place(cell);
+        int lines = 0;
+        for (const auto& line : LINES) {
+            if (line[0] != cell && line[1] != cell && line[2] != cell) continue;
+            lines += cell_at(child, line[0]) == S && cell_at(child, line[1]) == U &&
+                     cell_at(child, line[2]) == S;
+        }
+        return lines;
+    }
+
+    /**
+     * @brief Exact values of every position reachable from the empty board
+     * @return One entry per index; unreachable positions are 0
+     */
+    static vector<int8_t> solve_all() {
+        vector<int8_t> values(POSITIONS, 0);
+        vector<bool> done(POSITIONS, false);
+        value(0, values, done);
+        return values;
+    }
+
+private:
+    /** @brief Negamax over the cells, each position solved once. */
+    static int value(int index, vector<int8_t>& values, vector<bool>& done) {
+        if (done[index]) return values[index];
+
+        int letter = to_move(index);
+        int best = -CELLS; // Below any reachable difference
+        bool moved = false;
+        for (int cell = 0; cell < CELLS; cell++) {
+            if (cell_at(index, cell) != EMPTY) continue;
+            int child = index + letter * place(cell);
+            int v = gain(index, cell, letter) - value(child, values, done);
+            if (v > best) best = v;
+            moved = true;
+        }
+
+        values[index] = int8_t(moved ? best : 0);
+        done[index] = true;
+        return values[index];
+    }
+};
+
+#endif // SUS_SOLVER_H
@@ -4,11 +4,11 @@
 // WordBoard Implementation
 //-----------------------------------------------------
 
-WordBoard::WordBoard(const string& dict_file) : Board<char>(3, 3) {
+WordBoard::WordBoard(const string& dict_file) : FixedBoard() {
     // Initialize board with empty spaces
     for (int i = 0; i < 3; i++) {
         for (int j = 0; j < 3; j++) {
-            board[i][j] = ' ';
+            set_cell(i, j, ' ');
         }
     }
     load_dictionary(dict_file);
@@ -57,7 +57,7 @@ string WordBoard::extract_word(int row, int col, int dr, int dc) const {
         int r = row + i * dr;
         int c = col + i * dc;
         if (r < 0 || r >= 3 || c < 0 || c >= 3) return "";
-        word += board[r][c];
+        word += at(r, c);
     }
     return word;
 }
@@ -67,7 +67,7 @@ bool WordBoard::has_valid_word() const {
     for (int i = 0; i < 3; i++) {
         string word = extract_word(i, 0, 0, 1);
         if (is_valid_word(word)) {
-            cout << "Valid word found: " << word << " (Row " << i << ")\n";
+            if (!quiet) cout << "Valid word found: " << word << " (Row " << i << ")\n";
             return true;
         }
     }
@@ -76,7 +76,7 @@ bool WordBoard::has_valid_word() const {
     for (int j = 0; j < 3; j++) {
         string word = extract_word(0, j, 1, 0);
         if (is_valid_word(word)) {
-            cout << "Valid word found: " << word << " (Column " << j << ")\n";
+            if (!quiet) cout << "Valid word found: " << word << " (Column " << j << ")\n";
             return true;
         }
     }
@@ -84,47 +84,50 @@ bool WordBoard::has_valid_word() const {
     // Check diagonal (top-left to bottom-right)
     string diag1 = extract_word(0, 0, 1, 1);
     if (is_valid_word(diag1)) {
-        cout << "Valid word found: " << diag1 << " (Diagonal \\)\n";
+        if (!quiet) cout << "Valid word found: " << diag1 << " (Diagonal \\)\n";
         return true;
     }
 
     // Check diagonal (top-right to bottom-left)
     string diag2 = extract_word(0, 2, 1, -1);
     if (is_valid_word(diag2)) {
-        cout << "Valid word found: " << diag2 << " (Diagonal /)\n";
+        if (!quiet) cout << "Valid word found: " << diag2 << " (Diagonal /)\n";
         return true;
     }
 
     return false;
 }
 
-bool WordBoard::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char letter = move->get_symbol();
+bool WordBoard::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char letter = move.get_symbol();
 
     // Validate position
     if (x < 0 || x >= 3 || y < 0 || y >= 3) {
-        cout << "Invalid position! Row and column must be between 0 and 2.\n";
+        if (!quiet) cout << "Invalid position! Row and column must be between 0 and 2.\n";
         return false;
     }
 
     // Check if cell is empty
     if (board[x][y] != ' ') {
-        cout << "Cell is already occupied!\n";
+        if (!quiet) cout << "Cell is already occupied!\n";
         return false;
     }
 
     // Validate letter input
     if (!isalpha(letter)) {
-        cout << "Invalid input! Please enter a letter.\n";
+        if (!quiet) cout << "Invalid input! Please enter a letter.\n";
         return false;
     }
 
     // Place the letter on the board
-    board[x][y] = toupper(letter);
+    set_cell(x, y, toupper(letter));
     n_moves++;
 
+    // The rest only reports completed lines to the console
+    if (quiet) return true;
+
     // Check row - only if complete
     string row_word = extract_word(x, 0, 0, 1);
     if (row_word.find(' ') == string::npos) {
@@ -181,6 +184,30 @@ bool WordBoard::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+GameOutcome WordBoard::outcome_after(const Move<char>& last_move) {
+    int x = last_move.get_x();
+    int y = last_move.get_y();
+
+    // Only words through the new letter can be new
+    if (is_valid_word(extract_word(x, 0, 0, 1)) ||
+        is_valid_word(extract_word(0, y, 1, 0)) ||
+        (x == y && is_valid_word(extract_word(0, 0, 1, 1))) ||
+        (x + y == 2 && is_valid_word(extract_word(0, 2, 1, -1)))) {
+        return GameOutcome::WIN;
+    }
+    return n_moves == 9 ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void WordBoard::generate_moves(Player<char>*, MoveList<char>& moves) {
+    // Either player may place any letter on any empty cell
+    moves.clear();
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLUMNS; j++)
+            if (at(i, j) == ' ')
+                for (char letter = 'A'; letter <= 'Z'; letter++)
+                    moves.push_back(Move<char>(i, j, letter));
+}
+
 //-----------------------------------------------------
 // WordPlayer Implementation
 //-----------------------------------------------------
@@ -206,10 +233,10 @@ WordUI::WordUI()
         "Form a valid 3-letter word horizontally, vertically, or diagonally to win!", 3) {
 }
 
-Move<char>* WordUI::get_move(Player<char>* player) {
+Move<char> WordUI::get_move(Player<char>* player) {
     if (player->get_type() == PlayerType::COMPUTER) {
         // Simple random AI
-        vector<vector<char>> board_matrix = player->get_board_ptr()->get_board_matrix();
+        BoardView<char> board_matrix = player->get_board_ptr()->get_board_view();
         vector<pair<int, int>> empty_cells;
 
         for (int i = 0; i < 3; i++) {
@@ -221,7 +248,7 @@ Move<char>* WordUI::get_move(Player<char>* player) {
         }
 
         if (empty_cells.empty()) {
-            return new Move<char>(0, 0, 'A');
+            return Move<char>(0, 0, 'A');
         }
 
         // Pick random empty cell
@@ -233,7 +260,7 @@ Move<char>* WordUI::get_move(Player<char>* player) {
         char letter = 'A' + (rand() % 26);
 
         cout << "Computer plays: " << letter << " at position (" << x << ", " << y << ")\n";
-        return new Move<char>(x, y, letter);
+        return Move<char>(x, y, letter);
     }
 
     // Human player
@@ -264,7 +291,7 @@ Move<char>* WordUI::get_move(Player<char>* player) {
             clear_input_buffer();
         }
     }
-    return new Move<char>(x, y, letter);
+    return Move<char>(x, y, letter);
 }
 
 Player<char>* WordUI::create_player(string& name, char symbol, PlayerType type) {
@@ -14,7 +14,7 @@
  * A 3x3 grid where players place letters to form valid 3-letter words
  * horizontally, vertically, or diagonally.
  */
-class WordBoard : public Board<char> {
+class WordBoard : public FixedBoard<char, 3, 3> {
 private:
     set<string> dictionary; ///< Set of valid 3-letter words
 
@@ -54,11 +54,13 @@ public:
      */
     WordBoard(const string& dict_file = "dic.txt");
 
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
     bool is_win(Player<char>* player) override;
     bool is_lose(Player<char>* player) override;
     bool is_draw(Player<char>* player) override;
     bool game_is_over(Player<char>* player) override;
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
 };
 
 /**
@@ -83,7 +85,7 @@ public:
 class WordUI : public ValidatedUI<char> {
 public:
     WordUI();
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
 };
 
@@ -6,72 +6,36 @@
 
 using namespace std;
 
-XO_4x4_Board::XO_4x4_Board() : Board(4, 4) {
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
-    board[0][0] = 'X'; board[0][2] = 'X';
-    board[3][1] = 'X'; board[3][3] = 'X';
-
-    board[0][1] = 'O'; board[0][3] = 'O';
-    board[3][0] = 'O'; board[3][2] = 'O';
+XO_4x4_Board::XO_4x4_Board() : BitBoard_Board(4, 4) {
+    fill_cells(blank_symbol);
+    set_cell(0, 0, 'X'); set_cell(0, 2, 'X');
+    set_cell(3, 1, 'X'); set_cell(3, 3, 'X');
+
+    set_cell(0, 1, 'O'); set_cell(0, 3, 'O');
+    set_cell(3, 0, 'O'); set_cell(3, 2, 'O');
 }
 
-bool XO_4x4_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char mark = move->get_symbol();
+bool XO_4x4_Board::update_board(const Move<char>& move) {
+    // Decode the slide: x = from_x * 10 + to_x, y = from_y * 10 + to_y
+    int from_x = move.get_x() / 10, to_x = move.get_x() % 10;
+    int from_y = move.get_y() / 10, to_y = move.get_y() % 10;
+    char mark = toupper(move.get_symbol());
 
-    if (x < 0 || x >= rows || y < 0 || y >= columns) {
+    if (!is_valid_adjacent_move(from_x, from_y, to_x, to_y) ||
+        board[from_x][from_y] != mark) {
         return false;
     }
 
-
-    if (mark == '.') {
-        board[x][y] = blank_symbol;
-    }
-    else {
-        board[x][y] = toupper(mark);
-        n_moves++;
-        return true;
-    }
-
-
-
-    return false;
+    // Both writes belong to one move, so unmake_move() undoes them together
+    set_cell(from_x, from_y, blank_symbol);
+    set_cell(to_x, to_y, mark);
+    n_moves++;
+    return true;
 }
 
 bool XO_4x4_Board::is_win(Player<char>* player) {
-    const char sym = player->get_symbol();
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < columns - 2; ++j) {
-            if (board[i][j] == sym && board[i][j + 1] == sym && board[i][j + 2] == sym)
-                return true;
-        }
-    }
-
-    for (int j = 0; j < columns; ++j) {
-        for (int i = 0; i < rows - 2; ++i) {
-            if (board[i][j] == sym && board[i + 1][j] == sym && board[i + 2][j] == sym)
-                return true;
-        }
-    }
-
-    for (int i = 0; i < rows - 2; ++i) {
-        for (int j = 0; j < columns - 2; ++j) {
-            if (board[i][j] == sym && board[i + 1][j + 1] == sym && board[i + 2][j + 2] == sym)
-                return true;
-        }
-    }
-
-    for (int i = 0; i < rows - 2; ++i) {
-        for (int j = 2; j < columns; ++j) {
-            if (board[i][j] == sym && board[i + 1][j - 1] == sym && board[i + 2][j - 2] == sym)
-                return true;
-        }
-    }
-
-    return false;
+    // Three in a row in any direction, one shift-and-AND pass per direction
+    return has_line(player->get_symbol(), 3);
 }
 
 bool XO_4x4_Board::is_draw(Player<char>* player) {
@@ -82,6 +46,15 @@ bool XO_4x4_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+GameOutcome XO_4x4_Board::outcome_after(const Move<char>& last_move) {
+    // The slid token is the only new mark, so only its lines can have changed
+    int to_x = last_move.get_x() % 10;
+    int to_y = last_move.get_y() % 10;
+    if (has_line_through(last_move.get_symbol(), to_x, to_y, 3))
+        return GameOutcome::WIN;
+    return n_moves >= 16 ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
 bool XO_4x4_Board::is_valid_adjacent_move(int from_x, int from_y, int to_x, int to_y) {
     if (from_x < 0 || from_x >= rows || from_y < 0 || from_y >= columns ||
         to_x < 0 || to_x >= rows || to_y < 0 || to_y >= columns) {
@@ -97,26 +70,25 @@ bool XO_4x4_Board::is_valid_adjacent_move(int from_x, int from_y, int to_x, int
     return (dx == 1 && dy == 0) || (dx == 0 && dy == 1);
 }
 
-vector<Move<char>*> XO_4x4_Board::get_possible_moves(Player<char>* player) {
-    vector<Move<char>*> moves;
+void XO_4x4_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
     char symbol = player->get_symbol();
+    const int directions[4][2] = { {0,1}, {1,0}, {0,-1}, {-1,0} };
     for (int i = 0; i < rows; ++i) {
         for (int j = 0; j < columns; ++j) {
-            if (board[i][j] == symbol) {
-                int directions[4][2] = { {0,1}, {1,0}, {0,-1}, {-1,0} };
-                for (auto& dir : directions) {
-                    int new_i = i + dir[0];
-                    int new_j = j + dir[1];
-                    if (new_i >= 0 && new_i < rows && new_j >= 0 && new_j < columns &&
-                        board[new_i][new_j] == blank_symbol) {
-                        moves.push_back(new Move<char>(new_i, new_j, symbol));
-                    }
+            if (board[i][j] != symbol) continue;
+            for (auto& dir : directions) {
+                int new_i = i + dir[0];
+                int new_j = j + dir[1];
+                if (new_i >= 0 && new_i < rows && new_j >= 0 && new_j < columns &&
+                    board[new_i][new_j] == blank_symbol) {
+                    moves.push_back(Move<char>(i * 10 + new_i, j * 10 + new_j, symbol));
                 }
             }
         }
     }
-    return moves;
 }
+
 XO_4x4_UI::XO_4x4_UI() : ValidatedUI<char>("Welcome to 4x4 X-O Game", 3) {}
 
 Player<char>* XO_4x4_UI::create_player(string& name, char symbol, PlayerType type) {
@@ -126,48 +98,18 @@ Player<char>* XO_4x4_UI::create_player(string& name, char symbol, PlayerType typ
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* XO_4x4_UI::get_move(Player<char>* player) {
+Move<char> XO_4x4_UI::get_move(Player<char>* player) {
     if (player->get_type() == PlayerType::COMPUTER) {
-        XO_4x4_Board* board = dynamic_cast<XO_4x4_Board*>(player->get_board_ptr());
-        char symbol = player->get_symbol();
-        vector<pair<int, int>> my_tokens;
-        for (int i = 0; i < 4; i++) {
-            for (int j = 0; j < 4; j++) {
-                if (board->get_board_matrix()[i][j] == symbol) {
-                    my_tokens.push_back(make_pair(i, j));
-                }
-            }
-        }
-        if (!my_tokens.empty()) {
-            int token_index = rand() % my_tokens.size();
-            int from_x = my_tokens[token_index].first;
-            int from_y = my_tokens[token_index].second;
-            int directions[4][2] = { {-1,0}, {1,0}, {0,1}, {0,-1} };
-            for (int i = 0; i < 4; i++) {
-                int to_x = from_x + directions[i][0];
-                int to_y = from_y + directions[i][1];
-                if (to_x >= 0 && to_x < 4 && to_y >= 0 && to_y < 4) {
-                    if (board->is_valid_adjacent_move(from_x, from_y, to_x, to_y)) {
-                        Move<char>* remove_old = new Move<char>(from_x, from_y, '.');
-                        board->update_board(remove_old);
-                        delete remove_old;
-                        return new Move<char>(to_x, to_y, symbol);
-                    }
-                }
-            }
-        }
-        for (int i = 0; i < 4; i++) {
-            for (int j = 0; j < 4; j++) {
-                if (board->get_board_matrix()[i][j] == '.') {
-                    return new Move<char>(i, j, symbol);
-                }
-            }
+        MoveList<char> moves;
+        player->get_board_ptr()->generate_moves(player, moves);
+        if (!moves.empty()) {
+            return moves[rand() % moves.size()];
         }
     }
     return get_move_with_source(player);
 }
 
-Move<char>* XO_4x4_UI::get_move_with_source(Player<char>* player) {
+Move<char> XO_4x4_UI::get_move_with_source(Player<char>* player) {
     int from_x, from_y, to_x, to_y;
     XO_4x4_Board* board = dynamic_cast<XO_4x4_Board*>(player->get_board_ptr());
 
@@ -175,7 +117,7 @@ Move<char>* XO_4x4_UI::get_move_with_source(Player<char>* player) {
         auto pos = get_validated_position(
             "\nPlease enter your move x and y (0 to 3): ",
             4, 4);  // 0-3 range
-        return new Move<char>(pos.first, pos.second, player->get_symbol());
+        return Move<char>(pos.first, pos.second, player->get_symbol());
     }
 
     cout << "\n" << player->get_name() << "'s turn (" << player->get_symbol() << ")\n";
@@ -194,7 +136,7 @@ Move<char>* XO_4x4_UI::get_move_with_source(Player<char>* player) {
             continue;
         }
 
-        if (board->get_board_matrix()[from_x][from_y] != player->get_symbol()) {
+        if (board->get_cell(from_x, from_y) != player->get_symbol()) {
             cout << "Error: No token of yours at that position!\n";
             continue;
         }
@@ -213,10 +155,7 @@ Move<char>* XO_4x4_UI::get_move_with_source(Player<char>* player) {
         }
 
         if (board->is_valid_adjacent_move(from_x, from_y, to_x, to_y)) {
-            Move<char>* remove_move = new Move<char>(from_x, from_y, '.');
-            board->update_board(remove_move);
-            delete remove_move;
-            return new Move<char>(to_x, to_y, player->get_symbol());
+            return Move<char>(from_x * 10 + to_x, from_y * 10 + to_y, player->get_symbol());
         } else {
             cout << "Invalid move! Destination must be empty and adjacent (horizontal/vertical).\n";
         }
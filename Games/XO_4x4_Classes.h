@@ -12,19 +12,20 @@
 
 #include "BoardGame_Classes.h"
 #include "ValidatedUI.h"
+#include "BitBoard.h"
 using namespace std;
 
 /**
  * @class XO_4x4_Board
  * @brief Represents the 4x4 Tic-Tac-Toe game board.
  *
- * This class inherits from the generic `Board<char>` class and implements
+ * This class inherits from `BitBoard_Board` and implements
  * the specific logic required for the 4x4 Tic-Tac-Toe game, including
  * move updates, win/draw detection, and token movement.
  *
- * @see Board
+ * @see BitBoard_Board
  */
-class XO_4x4_Board : public Board<char> {
+class XO_4x4_Board : public BitBoard_Board {
 private:
     char blank_symbol = '.'; ///< Character used to represent an empty cell on the board.
 
@@ -37,11 +38,16 @@ public:
     XO_4x4_Board();
 
     /**
-     * @brief Updates the board with a player's move.
-     * @param move Pointer to a Move<char> object containing move coordinates and symbol.
+     * @brief Slides one of the player's tokens to an adjacent empty cell.
+     *
+     * The source and destination travel in one move, encoded as
+     * x = from_x * 10 + to_x and y = from_y * 10 + to_y, so the whole slide
+     * is a single make_move()/unmake_move() step.
+     *
+     * @param move Move<char> object containing the encoded slide and symbol.
      * @return true if the move is valid and successfully applied, false otherwise.
      */
-    bool update_board(Move<char>* move);
+    bool update_board(const Move<char>& move);
 
     /**
      * @brief Checks if the given player has won the game.
@@ -71,6 +77,20 @@ public:
      */
     bool game_is_over(Player<char>* player);
 
+    /**
+     * @brief Decides the game from the lines through the slid token only.
+     * @param last_move The encoded slide that was just applied.
+     * @return WIN on three in a row through the destination, DRAW after 16 moves.
+     */
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+
+    /**
+     * @brief Lists every slide of one of the player's tokens to an adjacent empty cell.
+     * @param player Pointer to the player to move.
+     * @param moves Buffer filled with slides encoded like update_board() expects.
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
+
     /**
      * @brief Checks if a move to an adjacent cell is valid.
      * @param from_x Original x position.
@@ -80,13 +100,6 @@ public:
      * @return true if the move is to an adjacent empty cell, false otherwise.
      */
     bool is_valid_adjacent_move(int from_x, int from_y, int to_x, int to_y);
-
-    /**
-     * @brief Gets all possible moves for a player.
-     * @param player Pointer to the player.
-     * @return Vector of possible moves.
-     */
-    vector<Move<char>*> get_possible_moves(Player<char>* player);
 };
 
 /**
@@ -124,16 +137,16 @@ public:
     /**
      * @brief Retrieves the next move from a player.
      * @param player Pointer to the player whose move is being requested.
-     * @return A pointer to a new `Move<char>` object representing the player's action.
+     * @return A `Move<char>` object representing the player's action.
      */
-    virtual Move<char>* get_move(Player<char>* player);
+    virtual Move<char> get_move(Player<char>* player);
 
     /**
      * @brief Asks user for source and destination coordinates for moving tokens.
      * @param player Pointer to the current player.
-     * @return Pointer to Move object representing the move.
+     * @return Move object representing the move.
      */
-    Move<char>* get_move_with_source(Player<char>* player);
+    Move<char> get_move_with_source(Player<char>* player);
 };
 
 #endif // XO_4X4_CLASSES_H
@@ -8,85 +8,37 @@ using namespace std;
 // XO_5x5_Board Implementation
 //=====================================================
 
-XO_5x5_Board::XO_5x5_Board() : Board(5, 5) {
+XO_5x5_Board::XO_5x5_Board() : BitBoard_Board(5, 5) {
     // Initialize empty board
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < columns; j++) {
-            board[i][j] = ' ';
-        }
-    }
+    fill_cells(' ');
 }
 
-bool XO_5x5_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char symbol = move->get_symbol();
+bool XO_5x5_Board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char symbol = move.get_symbol();
 
     // Check if move is valid
     if (x < 0 || x >= rows || y < 0 || y >= columns) {
-        cout << "Invalid position! Please choose between (0-4, 0-4)\n";
+        if (!quiet) cout << "Invalid position! Please choose between (0-4, 0-4)\n";
         return false;
     }
 
     if (board[x][y] != ' ') {
-        cout << "Cell is already occupied! Choose another cell.\n";
+        if (!quiet) cout << "Cell is already occupied! Choose another cell.\n";
         return false;
     }
 
     // Update board
-    board[x][y] = symbol;
+    set_cell(x, y, symbol);
     n_moves++;
     return true;
 }
 
 int XO_5x5_Board::count_three_in_row(char symbol) {
-    int count = 0;
-
-    // Check horizontal sequences
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j <= columns - 3; j++) {
-            if (board[i][j] == symbol &&
-                board[i][j + 1] == symbol &&
-                board[i][j + 2] == symbol) {
-                count++;
-            }
-        }
-    }
-
-    // Check vertical sequences
-    for (int i = 0; i <= rows - 3; i++) {
-        for (int j = 0; j < columns; j++) {
-            if (board[i][j] == symbol &&
-                board[i + 1][j] == symbol &&
-                board[i + 2][j] == symbol) {
-                count++;
-            }
-        }
-    }
-
-    // Check diagonal (\) sequences
-    for (int i = 0; i <= rows - 3; i++) {
-        for (int j = 0; j <= columns - 3; j++) {
-            if (board[i][j] == symbol &&
-                board[i + 1][j + 1] == symbol &&
-                board[i + 2][j + 2] == symbol) {
-                count++;
-            }
-        }
-    }
-
-    // Check anti-diagonal (/) sequences
-    for (int i = 0; i <= rows - 3; i++) {
-        for (int j = 2; j < columns; j++) {
-            if (board[i][j] == symbol &&
-                board[i + 1][j - 1] == symbol &&
-                board[i + 2][j - 2] == symbol) {
-                count++;
-            }
-        }
-    }
-
-    return count;
+    // Horizontal, vertical, diagonal (\) and anti-diagonal (/) windows,
+    // each counted with a popcount over the shifted bitboard
+    return bits.count_lines(symbol, 3);
 }
 
 bool XO_5x5_Board::is_win(Player<char>* player) {
@@ -117,6 +69,25 @@ bool XO_5x5_Board::game_is_over(Player<char>* player) {
     return n_moves >= 24;
 }
 
+GameOutcome XO_5x5_Board::outcome_after(const Move<char>& last_move) {
+    if (n_moves < 24) return GameOutcome::ONGOING;
+
+    char current_symbol = toupper(last_move.get_symbol());
+    char opponent_symbol = (current_symbol == 'X') ? 'O' : 'X';
+
+    int current_score = count_three_in_row(current_symbol);
+    int opponent_score = count_three_in_row(opponent_symbol);
+
+    if (current_score > opponent_score) return GameOutcome::WIN;
+    if (current_score < opponent_score) return GameOutcome::LOSS;
+    return GameOutcome::DRAW;
+}
+
+void XO_5x5_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    add_empty_cells(player->get_symbol(), moves);
+}
+
 void XO_5x5_Board::display_scores(Player<char>* player1, Player<char>* player2) {
     int score1 = count_three_in_row(player1->get_symbol());
     int score2 = count_three_in_row(player2->get_symbol());
@@ -132,7 +103,7 @@ void XO_5x5_Board::display_scores(Player<char>* player1, Player<char>* player2)
 
 XO_5x5_UI::XO_5x5_UI() : ValidatedUI<char>("=== 5x5 Three-in-a-Row Game ===", 3) {}
 
-Move<char>* XO_5x5_UI::get_move(Player<char>* player) {
+Move<char> XO_5x5_UI::get_move(Player<char>* player) {
     int x, y;
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -154,7 +125,7 @@ Move<char>* XO_5x5_UI::get_move(Player<char>* player) {
              << ") plays at: " << x << " " << y << endl;
     }
 
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
 
 Player<char>** XO_5x5_UI::setup_players() {
@@ -208,7 +179,7 @@ void XO_5x5_GameManager::run() {
     players[1]->set_board_ptr(board);
 
     // Display initial board
-    ui->display_board_matrix(board->get_board_matrix());
+    ui->display_board_matrix(board->get_board_view());
 
     // Main game loop - continue until 24 moves
     while (board->get_moves_count() < 24) {
@@ -216,15 +187,13 @@ void XO_5x5_GameManager::run() {
             Player<char>* currentPlayer = players[i];
 
             // Get and validate move
-            Move<char>* move = ui->get_move(currentPlayer);
+            Move<char> move = ui->get_move(currentPlayer);
             while (!board->update_board(move)) {
-                delete move;
                 move = ui->get_move(currentPlayer);
             }
-            delete move;
 
             // Display updated board
-            ui->display_board_matrix(board->get_board_matrix());
+            ui->display_board_matrix(board->get_board_view());
 
             // Check if we reached 24 moves
             if (board->get_moves_count() >= 24) {
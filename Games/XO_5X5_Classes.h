@@ -3,6 +3,7 @@
 
 #include "BoardGame_Classes.h"
 #include "ValidatedUI.h"
+#include "BitBoard.h"
 #include <vector>
 #include <string>
 
@@ -11,7 +12,7 @@ using namespace std;
 /**
  * @brief Represents the game board for 5x5 Three-in-a-Row
  */
-class XO_5x5_Board : public Board<char> {
+class XO_5x5_Board : public BitBoard_Board {
 private:
     /**
      * @brief Counts all three-in-a-row sequences for a given symbol (horizontal, vertical, and diagonals)
@@ -29,7 +30,7 @@ public:
     /**
      * @brief Updates the board with a move
      */
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
 
     /**
      * @brief Checks if a player has the most three-in-a-row sequences (win condition)
@@ -51,6 +52,16 @@ public:
      */
     bool game_is_over(Player<char>* player) override;
 
+    /**
+     * @brief ONGOING until 24 moves are made, then compare the scores
+     */
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+
+    /**
+     * @brief Every empty cell is a legal move
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
+
     /**
      * @brief Displays the scores for both players
      */
@@ -77,7 +88,7 @@ public:
     /**
      * @brief Gets move from player
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 
     /**
      * @brief Creates a player with given parameters
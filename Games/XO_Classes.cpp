@@ -9,55 +9,29 @@ using namespace std;
 
 //--------------------------------------- X_O_Board Implementation
 
-X_O_Board::X_O_Board() : Board(3, 3) {
+X_O_Board::X_O_Board() : BitBoard_Board(3, 3) {
     // Initialize all cells with blank_symbol
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+    fill_cells(blank_symbol);
 }
 
-bool X_O_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char mark = move->get_symbol();
+bool X_O_Board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char mark = move.get_symbol();
 
-    // Validate move and apply if valid
+    // Validate move and apply if valid (take moves back with unmake_move())
     if (!(x < 0 || x >= rows || y < 0 || y >= columns) &&
-        (board[x][y] == blank_symbol || mark == 0)) {
-
-        if (mark == 0) { // Undo move
-            n_moves--;
-            board[x][y] = blank_symbol;
-        }
-        else {         // Apply move
-            n_moves++;
-            board[x][y] = toupper(mark);
-        }
+        board[x][y] == blank_symbol) {
+        n_moves++;
+        set_cell(x, y, toupper(mark));
         return true;
     }
     return false;
 }
 
 bool X_O_Board::is_win(Player<char>* player) {
-    const char sym = player->get_symbol();
-
-    auto all_equal = [&](char a, char b, char c) {
-        return a == b && b == c && a != blank_symbol;
-        };
-
-    // Check rows and columns
-    for (int i = 0; i < rows; ++i) {
-        if ((all_equal(board[i][0], board[i][1], board[i][2]) && board[i][0] == sym) ||
-            (all_equal(board[0][i], board[1][i], board[2][i]) && board[0][i] == sym))
-            return true;
-    }
-
-    // Check diagonals
-    if ((all_equal(board[0][0], board[1][1], board[2][2]) && board[1][1] == sym) ||
-        (all_equal(board[0][2], board[1][1], board[2][0]) && board[1][1] == sym))
-        return true;
-
-    return false;
+    // Rows, columns and both diagonals in one shift-and-AND pass
+    return has_line(player->get_symbol(), 3);
 }
 
 bool X_O_Board::is_draw(Player<char>* player) {
@@ -68,6 +42,18 @@ bool X_O_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+GameOutcome X_O_Board::outcome_after(const Move<char>& last_move) {
+    // Only lines through the new mark can have changed
+    if (has_line_through(last_move.get_symbol(), last_move.get_x(), last_move.get_y(), 3))
+        return GameOutcome::WIN;
+    return n_moves == 9 ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void X_O_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    add_empty_cells(player->get_symbol(), moves);
+}
+
 //--------------------------------------- XO_UI Implementation
 
 XO_UI::XO_UI() : UI<char>("Weclome to FCAI X-O Game by Dr El-Ramly", 3) {}
@@ -80,7 +66,7 @@ Player<char>* XO_UI::create_player(string& name, char symbol, PlayerType type) {
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* XO_UI::get_move(Player<char>* player) {
+Move<char> XO_UI::get_move(Player<char>* player) {
     int x, y;
     
     if (player->get_type() == PlayerType::HUMAN) {
@@ -91,5 +77,5 @@ Move<char>* XO_UI::get_move(Player<char>* player) {
         x = rand() % player->get_board_ptr()->get_rows();
         y = rand() % player->get_board_ptr()->get_columns();
     }
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
@@ -11,19 +11,20 @@
 #define XO_CLASSES_H
 
 #include "BoardGame_Classes.h"
+#include "BitBoard.h"
 using namespace std;
 
 /**
  * @class X_O_Board
  * @brief Represents the Tic-Tac-Toe game board.
  *
- * This class inherits from the generic `Board<char>` class and implements
+ * This class inherits from `BitBoard_Board` and implements
  * the specific logic required for the Tic-Tac-Toe (X-O) game, including
  * move updates, win/draw detection, and display functions.
  *
- * @see Board
+ * @see BitBoard_Board
  */
-class X_O_Board : public Board<char> {
+class X_O_Board : public BitBoard_Board {
 private:
     char blank_symbol = '.'; ///< Character used to represent an empty cell on the board.
 
@@ -35,10 +36,10 @@ public:
 
     /**
      * @brief Updates the board with a player's move.
-     * @param move Pointer to a Move<char> object containing move coordinates and symbol.
+     * @param move Move<char> object containing move coordinates and symbol.
      * @return true if the move is valid and successfully applied, false otherwise.
      */
-    bool update_board(Move<char>* move);
+    bool update_board(const Move<char>& move);
 
     /**
      * @brief Checks if the given player has won the game.
@@ -67,6 +68,20 @@ public:
      * @return true if the game has ended, false otherwise.
      */
     bool game_is_over(Player<char>* player);
+
+    /**
+     * @brief Decide the game from the lines through the last move only.
+     * @param last_move The move that was just applied.
+     * @return WIN on three in a row through the new mark, DRAW on a full board.
+     */
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+
+    /**
+     * @brief Lists every empty cell as a move for the player.
+     * @param player Pointer to the player to move.
+     * @param moves Buffer filled with the legal moves.
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
 };
 
 
@@ -105,9 +120,9 @@ public:
     /**
      * @brief Retrieves the next move from a player.
      * @param player Pointer to the player whose move is being requested.
-     * @return A pointer to a new `Move<char>` object representing the player's action.
+     * @return A `Move<char>` object representing the player's action.
      */
-    virtual Move<char>* get_move(Player<char>* player);
+    virtual Move<char> get_move(Player<char>* player);
 };
 
 #endif // XO_CLASSES_H
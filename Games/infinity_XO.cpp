@@ -7,33 +7,31 @@ using namespace std;
 
 //--------------------------------------- infinity_Board Implementation
 
-infinity_Board::infinity_Board() : Board(3, 3) {
+infinity_Board::infinity_Board() : FixedBoard() {
     // Initialize all cells with blank_symbol
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+    fill_cells(blank_symbol);
 }
 
-bool infinity_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char mark = move->get_symbol();
+bool infinity_Board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char mark = move.get_symbol();
 
     // Validate move position
     if (x < 0 || x >= rows || y < 0 || y >= columns) {
-        cout << "Invalid position! Please choose between (0-2, 0-2)\n";
+        if (!quiet) cout << "Invalid position! Please choose between (0-2, 0-2)\n";
         return false;
     }
 
     // Check if cell is empty
     if (board[x][y] != blank_symbol) {
-        cout << "Cell is already occupied! Choose another cell.\n";
+        if (!quiet) cout << "Cell is already occupied! Choose another cell.\n";
         return false;
     }
 
     // Place the mark
-    board[x][y] = toupper(mark);
-    move_history.push({x, y});
+    set_cell(x, y, toupper(mark));
+    move_history.push_back({x, y});
     n_moves++;
 
     // CRITICAL: After every 3 moves, remove the oldest mark
@@ -48,15 +46,31 @@ bool infinity_Board::update_board(Move<char>* move) {
 void infinity_Board::remove_oldest_move() {
     if (!move_history.empty()) {
         auto oldest = move_history.front();
-        move_history.pop();
+        move_history.pop_front();
 
         int x = oldest.first;
         int y = oldest.second;
 
         // Clear the oldest mark
-        board[x][y] = blank_symbol;
+        set_cell(x, y, blank_symbol);
         
-        cout << "Oldest mark at (" << x << ", " << y << ") has disappeared!\n";
+        if (!quiet) cout << "Oldest mark at (" << x << ", " << y << ") has disappeared!\n";
+    }
+}
+
+void infinity_Board::save_state() {
+    saved_oldest.push_back(move_history.empty() ? make_pair(-1, -1) : move_history.front());
+}
+
+void infinity_Board::restore_state(bool applied) {
+    pair<int, int> oldest = saved_oldest.back();
+    saved_oldest.pop_back();
+    if (!applied) return;
+
+    // The cell itself is restored from the journal; only the order is kept here
+    move_history.pop_back();
+    if (oldest.first != -1 && (move_history.empty() || move_history.front() != oldest)) {
+        move_history.push_front(oldest);
     }
 }
 
@@ -69,22 +83,22 @@ bool infinity_Board::is_win(Player<char>* player) {
     };
 
     // Check rows and columns
-    for (int i = 0; i < rows; ++i) {
+    for (int i = 0; i < ROWS; ++i) {
         // Check row
-        if (all_equal(board[i][0], board[i][1], board[i][2]))
+        if (all_equal(at(i, 0), at(i, 1), at(i, 2)))
             return true;
         
         // Check column
-        if (all_equal(board[0][i], board[1][i], board[2][i]))
+        if (all_equal(at(0, i), at(1, i), at(2, i)))
             return true;
     }
 
     // Check main diagonal (top-left to bottom-right)
-    if (all_equal(board[0][0], board[1][1], board[2][2]))
+    if (all_equal(at(0, 0), at(1, 1), at(2, 2)))
         return true;
 
     // Check anti-diagonal (top-right to bottom-left)
-    if (all_equal(board[0][2], board[1][1], board[2][0]))
+    if (all_equal(at(0, 2), at(1, 1), at(2, 0)))
         return true;
 
     return false;
@@ -101,6 +115,32 @@ bool infinity_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+GameOutcome infinity_Board::outcome_after(const Move<char>& last_move) {
+    int x = last_move.get_x();
+    int y = last_move.get_y();
+    char sym = toupper(last_move.get_symbol());
+
+    // Removing the oldest mark never makes a line, so only the new mark's lines count
+    auto line = [&](int r, int c, int dr, int dc) {
+        return at(r, c) == sym && at(r + dr, c + dc) == sym &&
+               at(r + 2 * dr, c + 2 * dc) == sym;
+    };
+
+    if (line(x, 0, 0, 1) || line(0, y, 1, 0) ||
+        (x == y && line(0, 0, 1, 1)) || (x + y == 2 && line(0, 2, 1, -1))) {
+        return GameOutcome::WIN;
+    }
+    return n_moves >= 50 ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void infinity_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLUMNS; j++)
+            if (at(i, j) == blank_symbol)
+                moves.push_back(Move<char>(i, j, player->get_symbol()));
+}
+
 //--------------------------------------- infinity_UI Implementation
 
 infinity_UI::infinity_UI() : ValidatedUI<char>("=== Welcome to Infinity Tic-Tac-Toe ===\n"
@@ -114,7 +154,7 @@ Player<char>* infinity_UI::create_player(string& name, char symbol, PlayerType t
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* infinity_UI::get_move(Player<char>* player) {
+Move<char> infinity_UI::get_move(Player<char>* player) {
     int x, y;
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -140,5 +180,5 @@ Move<char>* infinity_UI::get_move(Player<char>* player) {
              << ") plays at: " << x << " " << y << endl;
     }
 
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
@@ -7,7 +7,7 @@
 
 #include "BoardGame_Classes.h"
 #include "ValidatedUI.h"
-#include <queue>
+#include <deque>
 using namespace std;
 
 /**
@@ -17,10 +17,22 @@ using namespace std;
  * After every 3 moves, the oldest mark on the board disappears.
  * Win by aligning 3 marks before they vanish.
  */
-class infinity_Board : public Board<char> {
+class infinity_Board : public FixedBoard<char, 3, 3> {
 private:
     char blank_symbol = '.'; ///< Character for empty cell
-    queue<pair<int, int>> move_history; ///< Track move positions in order
+    deque<pair<int, int>> move_history; ///< Track move positions in order (oldest first)
+    vector<pair<int, int>> saved_oldest; ///< Oldest mark before each move on the undo stack
+
+protected:
+    /**
+     * @brief Remember the oldest mark before a move, in case the move makes it vanish.
+     */
+    void save_state() override;
+
+    /**
+     * @brief Take the move's mark off move_history and bring back a vanished mark.
+     */
+    void restore_state(bool applied) override;
 
 public:
     /**
@@ -32,7 +44,7 @@ public:
      * @brief Updates the board with a player's move.
      * After every 3 moves, removes the oldest mark.
      */
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
 
     /**
      * @brief Removes the oldest move from the board.
@@ -58,6 +70,16 @@ public:
      * @brief Determines if the game is over (win or draw).
      */
     bool game_is_over(Player<char>* player) override;
+
+    /**
+     * @brief Decides the game from the lines through the last mark only.
+     */
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+
+    /**
+     * @brief Lists every empty cell as a move for the player.
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
 };
 
 /**
@@ -84,7 +106,7 @@ public:
     /**
      * @brief Retrieves the next move from a player.
      */
-    Move<char>* get_move(Player<char>* player) override;
+    Move<char> get_move(Player<char>* player) override;
 };
 
 #endif // INFINITY_XO_CLASSES_H
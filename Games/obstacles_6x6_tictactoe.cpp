@@ -8,13 +8,9 @@ using namespace std;
 // XO_6x6_Board Implementation
 // -----------------------------------------------------
 
-XO_6x6_Board::XO_6x6_Board() : Board(6, 6), obstacles_count(0) {
+XO_6x6_Board::XO_6x6_Board() : BitBoard_Board(6, 6), obstacles_count(0) {
     // Initialize empty board
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < columns; j++) {
-            board[i][j] = ' ';
-        }
-    }
+    fill_cells(' ');
 
     //// >>> CHANGE: No obstacles at start
     // add_random_obstacles();
@@ -28,31 +24,31 @@ void XO_6x6_Board::add_random_obstacles() {
         int y = rand() % 6;
 
         if (board[x][y] == ' ') {
-            board[x][y] = '#';
+            set_cell(x, y, '#');
             count++;
             obstacles_count++;
         }
     }
 }
 
-bool XO_6x6_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char symbol = move->get_symbol();
+bool XO_6x6_Board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char symbol = move.get_symbol();
 
     // Check if move is valid
     if (x < 0 || x >= rows || y < 0 || y >= columns) {
-        cout << "Invalid position! Please choose between (0-5, 0-5)\n";
+        if (!quiet) cout << "Invalid position! Please choose between (0-5, 0-5)\n";
         return false;
     }
 
     if (board[x][y] != ' ') {
-        cout << "Cell is already occupied! Choose another cell.\n";
+        if (!quiet) cout << "Cell is already occupied! Choose another cell.\n";
         return false;
     }
 
     // Update board
-    board[x][y] = symbol;
+    set_cell(x, y, symbol);
     n_moves++;
 
     //// >>> CHANGE: Add obstacles only after both X and O have played
@@ -77,6 +73,18 @@ bool XO_6x6_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+GameOutcome XO_6x6_Board::outcome_after(const Move<char>& last_move) {
+    // Obstacles never complete a line, so only the new mark matters
+    if (has_line_through(last_move.get_symbol(), last_move.get_x(), last_move.get_y(), 4))
+        return GameOutcome::WIN;
+    return n_moves == 36 - obstacles_count ? GameOutcome::DRAW : GameOutcome::ONGOING;
+}
+
+void XO_6x6_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    add_empty_cells(player->get_symbol(), moves);
+}
+
 void XO_6x6_Board::display_scores(Player<char>* player1, Player<char>* player2) {
     int score1 = 0, score2 = 0;
 
@@ -112,7 +120,7 @@ Player<char>* XO_6x6_UI::create_player(string& name, char symbol, PlayerType typ
 
     return new Player<char>(name, symbol, type);
 }
-Move<char>* XO_6x6_UI::get_move(Player<char>* player) {
+Move<char> XO_6x6_UI::get_move(Player<char>* player) {
     int x, y;
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -130,7 +138,7 @@ Move<char>* XO_6x6_UI::get_move(Player<char>* player) {
         y = rand() % player->get_board_ptr()->get_columns();
     }
 
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
 
 // -----------------------------------------------------
@@ -163,7 +171,7 @@ void XO_6x6_GameManager::run() {
     players[1]->set_board_ptr(board);
 
     // Display initial board
-    ui->display_board_matrix(board->get_board_matrix());
+    ui->display_board_matrix(board->get_board_view());
 
     // Calculate max moves dynamically
     int max_moves = board->get_rows() * board->get_columns() - board->get_obstacles_count();
@@ -178,22 +186,20 @@ void XO_6x6_GameManager::run() {
             Player<char>* currentPlayer = players[i];
 
             // Get and validate move
-            Move<char>* move = ui->get_move(currentPlayer);
+            Move<char> move = ui->get_move(currentPlayer);
             while (!board->update_board(move)) {
-                delete move;
                 move = ui->get_move(currentPlayer);
             }
-            delete move;
 
             //// >>> CHANGE: Increment turn count
             turnCount++;
             //// <<< CHANGE
 
             // Display updated board
-            ui->display_board_matrix(board->get_board_matrix());
+            ui->display_board_matrix(board->get_board_view());
 
             // Check for win
-            if (board->is_win(currentPlayer)) {
+            if (board->outcome_after(move) == GameOutcome::WIN) {
                 ui->display_message(currentPlayer->get_name() + " wins!");
                 return;
             }
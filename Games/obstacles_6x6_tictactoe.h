@@ -13,6 +13,7 @@
 
 #include "BoardGame_Classes.h"
 #include "ValidatedUI.h"
+#include "BitBoard.h"
 #include <iostream>
 #include <iomanip>
 #include <cstdlib>
@@ -24,12 +25,30 @@ using namespace std;
  *
  * This class implements a 6x6 board where players try to connect 4 symbols
  * in a row (horizontally, vertically, or diagonally). Random obstacles are
- * added after every two moves to increase difficulty.
+ * added after every two moves to increase difficulty. Obstacles live in the
+ * bitboard's obstacle mask, so they simply never match a player's marks.
  */
-class XO_6x6_Board : public Board<char> {
+class XO_6x6_Board : public BitBoard_Board {
 private:
     const char blank_symbol = '.'; ///< Character used to represent an empty cell
     int obstacles_count; ///< Counter for the number of obstacles placed on the board
+    vector<int> saved_obstacles_count; ///< obstacles_count before each move on the undo stack
+
+protected:
+    /**
+     * @brief Save the obstacle counter before a move.
+     *
+     * The obstacle cells themselves are journaled by set_cell().
+     */
+    void save_state() override { saved_obstacles_count.push_back(obstacles_count); }
+
+    /**
+     * @brief Restore the obstacle counter saved before the move.
+     */
+    void restore_state(bool /*applied*/) override {
+        obstacles_count = saved_obstacles_count.back();
+        saved_obstacles_count.pop_back();
+    }
 
 public:
     /**
@@ -41,10 +60,10 @@ public:
 
     /**
      * @brief Updates the board with a player's move.
-     * @param move Pointer to a Move<char> object containing move coordinates and symbol.
+     * @param move Move<char> object containing move coordinates and symbol.
      * @return true if the move is valid and successfully applied, false otherwise.
      */
-    bool update_board(Move<char>* move);
+    bool update_board(const Move<char>& move);
 
     /**
      * @brief Checks if four symbols are connected in a row.
@@ -52,53 +71,8 @@ public:
      * @return true if four symbols are connected in any direction, false otherwise.
      */
     bool check_four_in_row(char sym) {
-        const int N = 6;
-
-        // Check Horizontal
-        for (int i = 0; i < N; i++) {
-            for (int j = 0; j <= N - 4; j++) {
-                if (board[i][j] == sym &&
-                    board[i][j + 1] == sym &&
-                    board[i][j + 2] == sym &&
-                    board[i][j + 3] == sym)
-                    return true;
-            }
-        }
-
-        // Check Vertical
-        for (int i = 0; i <= N - 4; i++) {
-            for (int j = 0; j < N; j++) {
-                if (board[i][j] == sym &&
-                    board[i + 1][j] == sym &&
-                    board[i + 2][j] == sym &&
-                    board[i + 3][j] == sym)
-                    return true;
-            }
-        }
-
-        // Check Main Diagonal
-        for (int i = 0; i <= N - 4; i++) {
-            for (int j = 0; j <= N - 4; j++) {
-                if (board[i][j] == sym &&
-                    board[i + 1][j + 1] == sym &&
-                    board[i + 2][j + 2] == sym &&
-                    board[i + 3][j + 3] == sym)
-                    return true;
-            }
-        }
-
-        // Check Anti-Diagonal
-        for (int i = 0; i <= N - 4; i++) {
-            for (int j = 3; j < N; j++) {
-                if (board[i][j] == sym &&
-                    board[i + 1][j - 1] == sym &&
-                    board[i + 2][j - 2] == sym &&
-                    board[i + 3][j - 3] == sym)
-                    return true;
-            }
-        }
-
-        return false;
+        // Horizontal, vertical, main and anti-diagonal via the bitboard
+        return has_line(sym, 4);
     }
 
     /**
@@ -154,6 +128,20 @@ public:
      */
     bool game_is_over(Player<char>* player);
 
+    /**
+     * @brief Decides the game from the lines through the new mark only.
+     * @param last_move The move that was just applied.
+     * @return WIN on four in a row through the mark, DRAW once the free cells run out.
+     */
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+
+    /**
+     * @brief Lists every empty cell (obstacles excluded) as a move for the player.
+     * @param player Pointer to the player to move.
+     * @param moves Buffer filled with the legal moves.
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
+
     /**
      * @brief Adds random obstacles to the board.
      *
@@ -195,9 +183,9 @@ public:
     /**
      * @brief Retrieves the next move from a player.
      * @param player Pointer to the player whose move is being requested.
-     * @return A pointer to a new Move<char> object representing the player's action.
+     * @return A Move<char> object representing the player's action.
      */
-    virtual Move<char>* get_move(Player<char>* player);
+    virtual Move<char> get_move(Player<char>* player);
 };
 
 /**
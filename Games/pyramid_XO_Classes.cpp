@@ -7,21 +7,21 @@
 
 using namespace std;
 
-Pyramid_Board::Pyramid_Board() : Board(3, 5) {
+Pyramid_Board::Pyramid_Board() : FixedBoard() {
 
     for (int i = 0; i < rows; ++i) {
         for (int j = 0; j < columns; ++j) {
             if (i == 0 && j == 2) { 
-                board[i][j] = blank_symbol;
+                set_cell(i, j, blank_symbol);
             }
             else if (i == 1 && j >= 1 && j <= 3) {
-                board[i][j] = blank_symbol;
+                set_cell(i, j, blank_symbol);
             }
             else if (i == 2 && j >= 0 && j <= 4) {
-                board[i][j] = blank_symbol;
+                set_cell(i, j, blank_symbol);
             }
             else {
-                board[i][j] = ' ';
+                set_cell(i, j, ' ');
             }
         }
     }
@@ -45,13 +45,13 @@ bool Pyramid_Board::is_valid_cell(int x, int y) const {
     return false;
 }
 
-bool Pyramid_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char mark = move->get_symbol();
+bool Pyramid_Board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char mark = move.get_symbol();
 
     if (is_valid_cell(x, y) && board[x][y] == blank_symbol) {
-        board[x][y] = toupper(mark);
+        set_cell(x, y, toupper(mark));
         n_moves++;
         return true;
     }
@@ -61,34 +61,34 @@ bool Pyramid_Board::update_board(Move<char>* move) {
 bool Pyramid_Board::is_win(Player<char>* player) {
     const char sym = toupper(player->get_symbol());
 
-    if (board[1][1] == sym && board[1][2] == sym && board[1][3] == sym) return true;
+    if (at(1, 1) == sym && at(1, 2) == sym && at(1, 3) == sym) return true;
 
-    if (board[2][0] == sym && board[2][1] == sym && board[2][2] == sym) return true;
-    if (board[2][1] == sym && board[2][2] == sym && board[2][3] == sym) return true;
-    if (board[2][2] == sym && board[2][3] == sym && board[2][4] == sym) return true;
+    if (at(2, 0) == sym && at(2, 1) == sym && at(2, 2) == sym) return true;
+    if (at(2, 1) == sym && at(2, 2) == sym && at(2, 3) == sym) return true;
+    if (at(2, 2) == sym && at(2, 3) == sym && at(2, 4) == sym) return true;
 
-    if (board[0][2] == sym && board[1][2] == sym && board[2][2] == sym) return true;
+    if (at(0, 2) == sym && at(1, 2) == sym && at(2, 2) == sym) return true;
 
-    if (board[1][1] == sym && board[2][1] == sym) {
-        if (board[0][2] == sym) return true;
+    if (at(1, 1) == sym && at(2, 1) == sym) {
+        if (at(0, 2) == sym) return true;
     }
-    if (board[1][3] == sym && board[2][3] == sym) {
-        if (board[0][2] == sym) return true;
+    if (at(1, 3) == sym && at(2, 3) == sym) {
+        if (at(0, 2) == sym) return true;
     }
 
-    if (board[0][2] == sym && board[1][1] == sym && board[2][0] == sym) return true;
+    if (at(0, 2) == sym && at(1, 1) == sym && at(2, 0) == sym) return true;
 
-    if (board[0][2] == sym && board[1][3] == sym && board[2][4] == sym) return true;
+    if (at(0, 2) == sym && at(1, 3) == sym && at(2, 4) == sym) return true;
 
-    if (board[1][1] == sym && board[2][2] == sym && board[0][2] == sym) return true;
+    if (at(1, 1) == sym && at(2, 2) == sym && at(0, 2) == sym) return true;
 
-    if (board[1][3] == sym && board[2][2] == sym && board[0][2] == sym) return true;
+    if (at(1, 3) == sym && at(2, 2) == sym && at(0, 2) == sym) return true;
 
-    if (board[2][0] == sym && board[2][2] == sym && board[2][4] == sym) return true;
-    if (board[2][0] == sym && board[1][2] == sym && board[2][4] == sym) return true;
+    if (at(2, 0) == sym && at(2, 2) == sym && at(2, 4) == sym) return true;
+    if (at(2, 0) == sym && at(1, 2) == sym && at(2, 4) == sym) return true;
 
-    if (board[1][2] == sym && board[2][1] == sym && board[2][3] == sym) return true;
-    if (board[0][2] == sym && board[2][1] == sym && board[2][3] == sym) return true;
+    if (at(1, 2) == sym && at(2, 1) == sym && at(2, 3) == sym) return true;
+    if (at(0, 2) == sym && at(2, 1) == sym && at(2, 3) == sym) return true;
 
     return false;
 }
@@ -101,6 +101,14 @@ bool Pyramid_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+void Pyramid_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLUMNS; j++)
+            if (is_valid_cell(i, j) && at(i, j) == blank_symbol)
+                moves.push_back(Move<char>(i, j, player->get_symbol()));
+}
+
 Pyramid_UI::Pyramid_UI() : ValidatedUI<char>("Welcome to Pyramid X-O Game (3 Rows)", 3) {}
 
 Player<char>* Pyramid_UI::create_player(string& name, char symbol, PlayerType type) {
@@ -109,7 +117,7 @@ Player<char>* Pyramid_UI::create_player(string& name, char symbol, PlayerType ty
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Pyramid_UI::get_move(Player<char>* player) {
+Move<char> Pyramid_UI::get_move(Player<char>* player) {
     int x, y;
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -145,11 +153,11 @@ Move<char>* Pyramid_UI::get_move(Player<char>* player) {
 
         cout << "\nComputer chooses position (" << x << ", " << y << ")\n";
     }
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
 
-void Pyramid_UI::display_board_matrix(const vector<vector<char>>& matrix) const {
-    if (matrix.empty() || matrix[0].empty()) return;
+void Pyramid_UI::display_board_matrix(const BoardView<char>& matrix) const {
+    if (matrix.empty()) return;
 
     cout << "\nPyramid Tic-Tac-Toe Board (3 Rows):\n\n";
 
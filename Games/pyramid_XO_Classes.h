@@ -25,7 +25,7 @@ using namespace std;
  * - Row 3: 3 cells (base)
  * Total: 9 cells
  */
-class Pyramid_Board : public Board<char> {
+class Pyramid_Board : public FixedBoard<char, 3, 5> {
 private:
     char blank_symbol = '.'; ///< Character used to represent an empty cell
     vector<vector<bool>> valid_cells; ///< Matrix indicating valid pyramid positions
@@ -39,7 +39,7 @@ public:
     /**
      * @brief Updates the board with a player's move.
      */
-    bool update_board(Move<char>* move);
+    bool update_board(const Move<char>& move);
 
     /**
      * @brief Checks if the given player has won the game.
@@ -61,6 +61,11 @@ public:
      */
     bool game_is_over(Player<char>* player);
 
+    /**
+     * @brief Lists every empty pyramid cell as a move for the player.
+     */
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
+
     /**
      * @brief Checks if a cell position is valid in the pyramid.
      */
@@ -95,12 +100,12 @@ public:
     /**
      * @brief Retrieves the next move from a player.
      */
-    virtual Move<char>* get_move(Player<char>* player);
+    virtual Move<char> get_move(Player<char>* player);
 
     /**
      * @brief Display the pyramid board with proper formatting.
      */
-    virtual void display_board_matrix(const vector<vector<char>>& matrix) const;
+    virtual void display_board_matrix(const BoardView<char>& matrix) const;
 };
 
 #endif // PYRAMID_XO_CLASSES_H
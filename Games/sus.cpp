@@ -11,16 +11,14 @@ using namespace std;
 
 //--------------------------------------- SUS_Board Implementation
 
-SUS_Board::SUS_Board() : Board(3, 3) {
-    for (auto& row : board)
-        for (auto& cell : row)
-            cell = blank_symbol;
+SUS_Board::SUS_Board() : FixedBoard() {
+    fill_cells(blank_symbol);
 }
 
-bool SUS_Board::update_board(Move<char>* move) {
-    int x = move->get_x();
-    int y = move->get_y();
-    char mark = move->get_symbol();
+bool SUS_Board::update_board(const Move<char>& move) {
+    int x = move.get_x();
+    int y = move.get_y();
+    char mark = move.get_symbol();
 
     if (!(x < 0 || x >= rows || y < 0 || y >= columns) &&
         (board[x][y] == blank_symbol) && (mark == 'S' || mark == 'U')) {
@@ -28,7 +26,7 @@ bool SUS_Board::update_board(Move<char>* move) {
         int sequences_before = count_sus_sequences('S');
 
         n_moves++;
-        board[x][y] = toupper(mark);
+        set_cell(x, y, toupper(mark));
         int sequences_after = count_sus_sequences('S');
 
         int new_sequences = sequences_after - sequences_before;
@@ -45,29 +43,39 @@ bool SUS_Board::update_board(Move<char>* move) {
     return false;
 }
 
+void SUS_Board::save_state() {
+    saved_scores.push_back({player1_score, player2_score});
+}
+
+void SUS_Board::restore_state(bool /*applied*/) {
+    player1_score = saved_scores.back().first;
+    player2_score = saved_scores.back().second;
+    saved_scores.pop_back();
+}
+
 int SUS_Board::count_sus_sequences(char symbol) {
     int count = 0;
 
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j <= columns - 3; ++j) {
-            if (board[i][j] == 'S' && board[i][j+1] == 'U' && board[i][j+2] == 'S') {
+    for (int i = 0; i < ROWS; ++i) {
+        for (int j = 0; j <= COLUMNS - 3; ++j) {
+            if (at(i, j) == 'S' && at(i, j+1) == 'U' && at(i, j+2) == 'S') {
                 count++;
             }
         }
     }
 
-    for (int j = 0; j < columns; ++j) {
-        for (int i = 0; i <= rows - 3; ++i) {
-            if (board[i][j] == 'S' && board[i+1][j] == 'U' && board[i+2][j] == 'S') {
+    for (int j = 0; j < COLUMNS; ++j) {
+        for (int i = 0; i <= ROWS - 3; ++i) {
+            if (at(i, j) == 'S' && at(i+1, j) == 'U' && at(i+2, j) == 'S') {
                 count++;
             }
         }
     }
 
-    if (board[0][0] == 'S' && board[1][1] == 'U' && board[2][2] == 'S')
+    if (at(0, 0) == 'S' && at(1, 1) == 'U' && at(2, 2) == 'S')
         count++;
 
-    if (board[0][2] == 'S' && board[1][1] == 'U' && board[2][0] == 'S')
+    if (at(0, 2) == 'S' && at(1, 1) == 'U' && at(2, 0) == 'S')
         count++;
 
     return count;
@@ -92,6 +100,27 @@ bool SUS_Board::game_is_over(Player<char>* player) {
     return (n_moves == 9);
 }
 
+GameOutcome SUS_Board::outcome_after(const Move<char>& last_move) {
+    // Scores are already kept up to date by update_board()
+    if (n_moves < 9) return GameOutcome::ONGOING;
+
+    bool is_s = toupper(last_move.get_symbol()) == 'S';
+    int mine = is_s ? player1_score : player2_score;
+    int theirs = is_s ? player2_score : player1_score;
+
+    if (mine > theirs) return GameOutcome::WIN;
+    if (mine < theirs) return GameOutcome::LOSS;
+    return GameOutcome::DRAW;
+}
+
+void SUS_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    moves.clear();
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLUMNS; j++)
+            if (at(i, j) == blank_symbol)
+                moves.push_back(Move<char>(i, j, player->get_symbol()));
+}
+
 //--------------------------------------- SUS_UI Implementation
 
 SUS_UI::SUS_UI() : ValidatedUI<char>("Welcome to SUS Game!", 3) {
@@ -147,15 +176,14 @@ Player<char>** SUS_UI::setup_players() {
 Player<char>* SUS_UI::create_player(string& name, char symbol, PlayerType type) {
     if (type == PlayerType::AI) {
         cout << "Creating AI player: " << name << " (uses '" << symbol << "')\n";
-        char opponent_symbol = (symbol == 'S') ? 'U' : 'S';
-        return new SUS_AI_Player(name, symbol, opponent_symbol);
+        return new SUS_AI_Player(name, symbol);
     } else {
         cout << "Creating human player: " << name << " (uses '" << symbol << "')\n";
         return new Player<char>(name, symbol, type);
     }
 }
 
-Move<char>* SUS_UI::get_move(Player<char>* player) {
+Move<char> SUS_UI::get_move(Player<char>* player) {
     int x, y;
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -174,14 +202,9 @@ Move<char>* SUS_UI::get_move(Player<char>* player) {
     }
     else if (player->get_type() == PlayerType::AI) {
         // AI Smart Player
+        // The current scores don't matter: only the lines still to be made do
         SUS_AI_Player* ai_player = dynamic_cast<SUS_AI_Player*>(player);
-        SUS_Board* sus_board = dynamic_cast<SUS_Board*>(player->get_board_ptr());
-
-        auto scores = sus_board->get_scores();
-        int ai_score = (player->get_symbol() == 'S') ? scores.first : scores.second;
-        int opp_score = (player->get_symbol() == 'S') ? scores.second : scores.first;
-
-        ScoredMove best = ai_player->get_best_move(ai_score, opp_score);
+        ScoredMove best = ai_player->get_best_move();
 
         x = best.x;
         y = best.y;
@@ -190,7 +213,7 @@ Move<char>* SUS_UI::get_move(Player<char>* player) {
              << x << ", " << y << ")\n";
     }
 
-    return new Move<char>(x, y, player->get_symbol());
+    return Move<char>(x, y, player->get_symbol());
 }
 
 void SUS_UI::display_scores(int p1_score, int p2_score) {
@@ -15,21 +15,28 @@ using namespace std;
  * @class SUS_Board
  * @brief Represents the SUS game board.
  */
-class SUS_Board : public Board<char> {
+class SUS_Board : public FixedBoard<char, 3, 3> {
 private:
     char blank_symbol = '.';
     int player1_score = 0;
     int player2_score = 0;
+    vector<pair<int, int>> saved_scores; ///< Scores before each move on the undo stack
 
     int count_sus_sequences(char symbol);
 
+protected:
+    void save_state() override;
+    void restore_state(bool applied) override;
+
 public:
     SUS_Board();
-    bool update_board(Move<char>* move);
+    bool update_board(const Move<char>& move);
     bool is_win(Player<char>* player);
     bool is_lose(Player<char>*) { return false; }
     bool is_draw(Player<char>* player);
     bool game_is_over(Player<char>* player);
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
     pair<int, int> get_scores() const { return {player1_score, player2_score}; }
 };
 
@@ -52,7 +59,7 @@ public:
      */
     Player<char>** setup_players() override;
 
-    Move<char>* get_move(Player<char>* player);
+    Move<char> get_move(Player<char>* player);
     void display_scores(int p1_score, int p2_score);
 
 protected:
@@ -20,6 +20,8 @@ Ultimate_XO_Board::Ultimate_XO_Board()
         subBoards[i].resize(3);
         for (int j = 0; j < 3; j++) {
             subBoards[i][j] = new X_O_Board();
+            // The position hash covers the sub-boards, which hold the marks
+            hash ^= sub_board_key(i * 3 + j, subBoards[i][j]->get_hash());
         }
     }
 }
@@ -32,9 +34,9 @@ Ultimate_XO_Board::~Ultimate_XO_Board() {
     }
 }
 
-bool Ultimate_XO_Board::update_board(Move<char>* move) {
-    int boardRow = move->get_x();
-    int boardCol = move->get_y();
+bool Ultimate_XO_Board::update_board(const Move<char>& move) {
+    int boardRow = move.get_x();
+    int boardCol = move.get_y();
 
     // Decode: x = boardRow*10 + cellRow, y = boardCol*10 + cellCol
     int cellRow = boardRow % 10;
@@ -45,24 +47,29 @@ bool Ultimate_XO_Board::update_board(Move<char>* move) {
     // Validate coordinates
     if (boardRow < 0 || boardRow > 2 || boardCol < 0 || boardCol > 2 ||
         cellRow < 0 || cellRow > 2 || cellCol < 0 || cellCol > 2) {
-        cout << "Invalid move coordinates!\n";
+        if (!quiet) cout << "Invalid move coordinates!\n";
         return false;
     }
 
     // Check if this sub-board is already won
     if (mainBoard[boardRow][boardCol] != ' ') {
-        cout << "This board has already been won!\n";
+        if (!quiet) cout << "This board has already been won!\n";
         return false;
     }
 
-    // Try to make move in sub-board
-    Move<char> subMove(cellRow, cellCol, move->get_symbol());
-    if (!subBoards[boardRow][boardCol]->update_board(&subMove)) {
+    // Try to make move in sub-board, keeping it on the sub-board's undo stack
+    X_O_Board* subBoard = subBoards[boardRow][boardCol];
+    uint64_t subHash = subBoard->get_hash();
+    Move<char> subMove(cellRow, cellCol, move.get_symbol());
+    if (!subBoard->make_move(subMove)) {
         return false;
     }
+    int index = boardRow * 3 + boardCol;
+    hash ^= sub_board_key(index, subHash) ^ sub_board_key(index, subBoard->get_hash());
 
     // Update successful
     n_moves++;
+    played.push_back({ boardRow, boardCol, mainBoard[boardRow][boardCol] });
 
     // Check if this sub-board is now won
     char winner = check_sub_board_winner(boardRow, boardCol);
@@ -73,6 +80,20 @@ bool Ultimate_XO_Board::update_board(Move<char>* move) {
     return true;
 }
 
+void Ultimate_XO_Board::restore_state(bool applied) {
+    if (!applied) return;
+
+    // Take the move back in its sub-board and un-claim the main cell
+    PlayedMove last = played.back();
+    played.pop_back();
+    X_O_Board* subBoard = subBoards[last.boardRow][last.boardCol];
+    uint64_t subHash = subBoard->get_hash();
+    subBoard->unmake_move();
+    int index = last.boardRow * 3 + last.boardCol;
+    hash ^= sub_board_key(index, subHash) ^ sub_board_key(index, subBoard->get_hash());
+    mainBoard[last.boardRow][last.boardCol] = last.oldWinner;
+}
+
 char Ultimate_XO_Board::check_sub_board_winner(int boardRow, int boardCol) {
     X_O_Board* board = subBoards[boardRow][boardCol];
 
@@ -144,6 +165,48 @@ bool Ultimate_XO_Board::game_is_over(Player<char>* player) {
     return is_win(player) || is_draw(player);
 }
 
+GameOutcome Ultimate_XO_Board::outcome_after(const Move<char>& last_move) {
+    int boardRow = last_move.get_x() / 10;
+    int boardCol = last_move.get_y() / 10;
+
+    // The main board only changes when the move decided its sub-board
+    char sym = mainBoard[boardRow][boardCol];
+    if (sym == ' ') return GameOutcome::ONGOING;
+
+    if (sym != 'T') {
+        auto line = [&](int r, int c, int dr, int dc) {
+            return mainBoard[r][c] == sym && mainBoard[r + dr][c + dc] == sym &&
+                   mainBoard[r + 2 * dr][c + 2 * dc] == sym;
+        };
+        if (line(boardRow, 0, 0, 1) || line(0, boardCol, 1, 0) ||
+            (boardRow == boardCol && line(0, 0, 1, 1)) ||
+            (boardRow + boardCol == 2 && line(0, 2, 1, -1))) {
+            return GameOutcome::WIN;
+        }
+    }
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            if (mainBoard[i][j] == ' ') return GameOutcome::ONGOING;
+        }
+    }
+    return GameOutcome::DRAW;
+}
+
+void Ultimate_XO_Board::generate_moves(Player<char>* player, MoveList<char>& moves) {
+    // Collect each open sub-board's empty cells, encoded like update_board() expects
+    moves.clear();
+    MoveList<char> subMoves;
+    for (int br = 0; br < 3; br++) {
+        for (int bc = 0; bc < 3; bc++) {
+            if (!is_board_available(br, bc)) continue;
+            subBoards[br][bc]->generate_moves(player, subMoves);
+            for (const Move<char>& m : subMoves)
+                moves.push_back(Move<char>(br * 10 + m.get_x(), bc * 10 + m.get_y(), m.get_symbol()));
+        }
+    }
+}
+
 bool Ultimate_XO_Board::is_board_available(int boardRow, int boardCol) {
     if (boardRow < 0 || boardRow > 2 || boardCol < 0 || boardCol > 2) {
         return false;
@@ -169,12 +232,14 @@ Player<char>* Ultimate_XO_UI::create_player(string& name, char symbol, PlayerTyp
     return new Player<char>(name, symbol, type);
 }
 
-Move<char>* Ultimate_XO_UI::get_move(Player<char>* player) {
+Move<char> Ultimate_XO_UI::get_move(Player<char>* player) {
     Ultimate_XO_Board* board = dynamic_cast<Ultimate_XO_Board*>(player->get_board_ptr());
+    // Off-board move that update_board() always rejects
+    Move<char> no_move(-1, -1, player->get_symbol());
 
     if (!board) {
         cerr << "Error: Invalid board type!\n";
-        return nullptr;
+        return no_move;
     }
 
     if (player->get_type() == PlayerType::HUMAN) {
@@ -197,7 +262,7 @@ Move<char>* Ultimate_XO_UI::get_move(Player<char>* player) {
         int encodedX = boardRow * 10 + cellRow;
         int encodedY = boardCol * 10 + cellCol;
 
-        return new Move<char>(encodedX, encodedY, player->get_symbol());
+        return Move<char>(encodedX, encodedY, player->get_symbol());
     }
     else if (player->get_type() == PlayerType::COMPUTER) {
         // Random computer player - pick any available board
@@ -214,7 +279,7 @@ Move<char>* Ultimate_XO_UI::get_move(Player<char>* player) {
 
         if (availableBoards.empty()) {
             cout << "No available boards for computer!\n";
-            return nullptr;
+            return no_move;
         }
 
         // Pick random board
@@ -226,11 +291,11 @@ Move<char>* Ultimate_XO_UI::get_move(Player<char>* player) {
         X_O_Board* subBoard = board->get_sub_board(boardRow, boardCol);
         if (!subBoard) {
             cout << "Invalid sub-board!\n";
-            return nullptr;
+            return no_move;
         }
 
-        // Get the board matrix to check empty cells
-        auto subMatrix = subBoard->get_board_matrix();
+        // View the board cells to check empty cells
+        BoardView<char> subMatrix = subBoard->get_board_view();
         vector<pair<int,int>> emptyCells;
 
         for (int i = 0; i < 3; i++) {
@@ -244,7 +309,7 @@ Move<char>* Ultimate_XO_UI::get_move(Player<char>* player) {
 
         if (emptyCells.empty()) {
             cout << "No empty cells in selected board!\n";
-            return nullptr;
+            return no_move;
         }
 
         int cellIdx = rand() % emptyCells.size();
@@ -257,13 +322,13 @@ Move<char>* Ultimate_XO_UI::get_move(Player<char>* player) {
         int encodedX = boardRow * 10 + cellRow;
         int encodedY = boardCol * 10 + cellCol;
 
-        return new Move<char>(encodedX, encodedY, player->get_symbol());
+        return Move<char>(encodedX, encodedY, player->get_symbol());
     }
 
-    return nullptr;
+    return no_move;
 }
 
-void Ultimate_XO_UI::display_board_matrix(const vector<vector<char>>& matrix) const {
+void Ultimate_XO_UI::display_board_matrix(const BoardView<char>& matrix) const {
     // This will be called by GameManager - we need to cast and call our custom display
     // For now, just show a message
     cout << "\n(Board updated - see full display above)\n";
@@ -287,7 +352,7 @@ void Ultimate_XO_UI::display_full_board(Ultimate_XO_Board* board) const {
 
             for (int boardCol = 0; boardCol < 3; boardCol++) {
                 X_O_Board* subBoard = board->get_sub_board(boardRow, boardCol);
-                auto subMatrix = subBoard->get_board_matrix();
+                BoardView<char> subMatrix = subBoard->get_board_view();
 
                 if (boardCol > 0) cout << "    ";  // Space between boards
 
@@ -317,7 +382,7 @@ void Ultimate_XO_UI::display_full_board(Ultimate_XO_Board* board) const {
 }
 
 void Ultimate_XO_UI::display_main_board(Ultimate_XO_Board* board) const {
-    auto mainBoard = board->get_main_board();
+    const auto& mainBoard = board->get_main_board();
     
     cout << "   0   1   2\n";
     for (int i = 0; i < 3; i++) {
@@ -23,21 +23,41 @@ private:
     vector<vector<X_O_Board*>> subBoards;  // 3x3 grid of sub-boards
     vector<vector<char>> mainBoard;        // Track winners of each sub-board
 
+    /**
+     * @brief A sub-board move and the main-board cell it may have claimed.
+     */
+    struct PlayedMove {
+        int boardRow;
+        int boardCol;
+        char oldWinner;
+    };
+    vector<PlayedMove> played;             // Undo stack mirroring make_move()
+
+    // Zobrist-style key of sub-board index holding a position with hash h
+    static uint64_t sub_board_key(int index, uint64_t h) {
+        return mix_key(h + 0x9E3779B97F4A7C15ULL * uint64_t(index + 1));
+    }
+
+protected:
+    void restore_state(bool applied) override;
+
 public:
     Ultimate_XO_Board();
     ~Ultimate_XO_Board();
 
-    bool update_board(Move<char>* move) override;
+    bool update_board(const Move<char>& move) override;
     bool is_win(Player<char>* player) override;
     bool is_lose(Player<char>*) override { return false; }
     bool is_draw(Player<char>* player) override;
     bool game_is_over(Player<char>* player) override;
+    GameOutcome outcome_after(const Move<char>& last_move) override;
+    void generate_moves(Player<char>* player, MoveList<char>& moves) override;
 
     // Helper methods
     char check_sub_board_winner(int boardRow, int boardCol);
     bool is_board_available(int boardRow, int boardCol);
     X_O_Board* get_sub_board(int row, int col) const;
-    vector<vector<char>> get_main_board() const { return mainBoard; }
+    const vector<vector<char>>& get_main_board() const { return mainBoard; }
 };
 
 /**
@@ -49,8 +69,8 @@ public:
     Ultimate_XO_UI();
     ~Ultimate_XO_UI() {}
 
-    Move<char>* get_move(Player<char>* player) override;
-    void display_board_matrix(const vector<vector<char>>& matrix) const override;
+    Move<char> get_move(Player<char>* player) override;
+    void display_board_matrix(const BoardView<char>& matrix) const override;
     Player<char>* create_player(string& name, char symbol, PlayerType type) override;
 
     // Display helpers
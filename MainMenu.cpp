@@ -16,6 +16,7 @@
 #include "pyramid_XO_Classes.h"
 #include "ultimate_XO_Classes.h"
 #include "FourInARow.h"
+#include "ConnectK.h"
 
 using namespace std;
 
@@ -37,9 +38,10 @@ void display_menu() {
     cout << " 11. Infinity XO Tic-Tac-Toe\n";
     cout << " 12. Ultimate Tic-Tac-Toe (Bonus)\n";
     cout << " 13. Memory Tic-Tac-Toe (Bonus)\n";
+    cout << " 14. Connect-K (any board up to 16x16)\n";
     cout << " 0.  Exit\n";
     cout << "=============================================\n";
-    cout << "Choose a game (0-13): ";
+    cout << "Choose a game (0-14): ";
 }
 
 // -------------------- Game Functions --------------------
@@ -54,22 +56,20 @@ void play_sus_game() {
     players[0]->set_board_ptr(game_board);
     players[1]->set_board_ptr(game_board);
 
-    game_ui->display_board_matrix(game_board->get_board_matrix());
+    game_ui->display_board_matrix(game_board->get_board_view());
 
     Player<char>* currentPlayer = players[0];
     while (!game_board->game_is_over(currentPlayer)) {
         for (int i : {0, 1}) {
             currentPlayer = players[i];
-            Move<char>* move = game_ui->get_move(currentPlayer);
+            Move<char> move = game_ui->get_move(currentPlayer);
 
             while (!game_board->update_board(move)) {
                 cout << "Invalid move! Try again.\n";
-                delete move;
                 move = game_ui->get_move(currentPlayer);
             }
 
-            delete move;
-            game_ui->display_board_matrix(game_board->get_board_matrix());
+            game_ui->display_board_matrix(game_board->get_board_view());
 
             // Show scores after each move
             auto scores = dynamic_cast<SUS_Board*>(game_board)->get_scores();
@@ -126,6 +126,26 @@ void play_four_in_a_row() {
     cout << "\n*** Game Ended ***\n";
 }
 
+void play_connect_k() {
+    cout << "\n=== Starting Connect-K ===\n";
+    ConnectK_UI* game_ui = new ConnectK_UI();
+    int rows, columns, k;
+    game_ui->get_board_settings(rows, columns, k);
+    Board<char>* game_board = new ConnectK_Board(rows, columns, k);
+    Player<char>** players = game_ui->setup_players();
+
+    GameManager<char> game_manager(game_board, players, game_ui);
+    game_manager.run();
+
+    delete game_board;
+    delete players[0];
+    delete players[1];
+    delete[] players;
+    delete game_ui;
+
+    cout << "\n*** Game Ended ***\n";
+}
+
 void play_5x5_tictactoe() {
     cout << "\n=== Starting 5x5 Three-in-a-Row ===\n";
     XO_5x5_GameManager game_manager;
@@ -274,15 +294,13 @@ void play_ultimate_tic_tac_toe() {
     while (true) {
         Player<char>* currentPlayer = players[currentPlayerIndex];
 
-        Move<char>* move = ui->get_move(currentPlayer);
+        Move<char> move = ui->get_move(currentPlayer);
 
         while (!board->update_board(move)) {
-            delete move;
             cout << "Invalid move! Try again.\n";
             move = ui->get_move(currentPlayer);
         }
 
-        delete move;
 
         // Display board after move
         ui->display_full_board(board);
@@ -321,7 +339,7 @@ void play_memoryTicTacToe() {
     players[1]->set_board_ptr(game_board);
 
     cout << "\n=== Game Starting - Remember the positions! ===\n";
-    game_ui->display_board_matrix(fake_board->get_board_matrix());
+    game_ui->display_board_matrix(fake_board->get_board_view());
 
     Player<char>* currentPlayer = players[0];
     int turn = 0;
@@ -329,19 +347,17 @@ void play_memoryTicTacToe() {
     while (!game_board->game_is_over(currentPlayer)) {
         currentPlayer = players[turn % 2];
 
-        Move<char>* move = game_ui->get_move(currentPlayer);
+        Move<char> move = game_ui->get_move(currentPlayer);
 
         while (!game_board->update_board(move)) {
             cout << "Invalid move! Try again.\n";
-            delete move;
             move = game_ui->get_move(currentPlayer);
         }
 
         fake_board->update_board(move);
 
-        delete move;
 
-        game_ui->display_board_matrix(fake_board->get_board_matrix());
+        game_ui->display_board_matrix(fake_board->get_board_view());
 
         if (game_board->game_is_over(currentPlayer)) {
             break;
@@ -350,7 +366,7 @@ void play_memoryTicTacToe() {
     }
 
     cout << "\n=== Game Over! Revealing the board ===\n";
-    game_ui->display_board_matrix(game_board->get_board_matrix());
+    game_ui->display_board_matrix(game_board->get_board_view());
 
     if (game_board->is_win(players[0])) {
         game_ui->display_message(players[0]->get_name() + " wins!");
@@ -408,12 +424,13 @@ int main() {
             case 11: play_infinity_XO(); break;
             case 12: play_ultimate_tic_tac_toe(); break;
             case 13: play_memoryTicTacToe(); break;
+            case 14: play_connect_k(); break;
             case 0:
                 cout << "Thank you for playing! Goodbye!\n";
                 running = false;
                 break;
             default:
-                cout << "\nInvalid choice! Please select 0-13.\n";
+                cout << "\nInvalid choice! Please select 0-14.\n";
                 break;
         }
     }
@@ -0,0 +1,92 @@
+// AllocCheck.cpp
+// Checks that headless play allocates nothing per turn once warmed up
+//
+// Build from the repository root (AllocCounter.cpp replaces the global
+// operator new, so it is linked here and never into BoardGames):
+//   g++ -std=c++17 -O2 -I. -IGames -Itools tools/AllocCheck.cpp tools/AllocCounter.cpp
+//       Games/XO_Classes.cpp Games/MisereTicTacToe.cpp Games/sus.cpp Games/FourInARow.cpp
+//       -o alloc_check
+// Run:
+//   ./alloc_check                  1500 turns per game
+//   ./alloc_check --turns 100000
+//
+// Prints the allocations counted for each game; the exit status is 1 if
+// any game allocated in its counted pass.
+
+#include "AllocCounter.h"
+#include "FourInARow.h"
+#include "MisereTicTacToe.h"
+#include "XO_Classes.h"
+#include "sus.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+/**
+ * @brief Uniformly random legal move, without allocating
+ */
+static Move<char> random_move(Board<char>* board, Player<char>* player) {
+    MoveList<char> moves;
+    board->generate_moves(player, moves);
+    return moves[rand() % moves.size()];
+}
+
+/**
+ * @brief Play random headless games on board and count allocations
+ *
+ * The games are played twice from the same seed. The first pass lets
+ * every vector (journal, undo stacks, the result's move list) grow to the
+ * longest game; only the second pass, which replays the same games, is
+ * counted.
+ *
+ * @return Allocations made by the counted pass
+ */
+static size_t check(const char* name, Board<char>& board, char symbol0, char symbol1, int turns) {
+    Player<char> p0("First", symbol0, PlayerType::COMPUTER);
+    Player<char> p1("Second", symbol1, PlayerType::COMPUTER);
+    Player<char>* players[2] = { &p0, &p1 };
+    GameManager<char> manager(&board, players, nullptr);
+    MovePolicy<char> policy = random_move;
+    GameResult<char> result;
+
+    int played = 0;
+    AllocCounter counter;
+    for (int pass = 0; pass < 2; pass++) {
+        srand(1);
+        played = 0;
+        counter.reset();
+        while (played < turns) {
+            manager.run_headless(policy, policy, result);
+            played += result.n_moves;
+        }
+    }
+    size_t allocations = counter.get_allocations();
+
+    printf("%-14s %8zu allocations over %d turns\n", name, allocations, played);
+    return allocations;
+}
+
+int main(int argc, char** argv) {
+    int turns = 1500;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--turns") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            turns = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--turns N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    X_O_Board xo;
+    Misere_Board misere;
+    SUS_Board sus;
+    FourInARow_Board four;
+
+    size_t total = check("X-O", xo, 'X', 'O', turns) +
+                   check("Misere", misere, 'X', 'O', turns) +
+                   check("SUS", sus, 'S', 'U', turns) +
+                   check("Four-in-a-Row", four, 'X', 'O', turns);
+    return total == 0 ? 0 : 1;
+}
@@ -0,0 +1,38 @@
+// AllocCounter.h
+// Counts heap allocations so hot loops can be checked for zero-allocation turns
+
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <cstddef>
+
+/**
+ * @brief Counts global operator new calls made since it was constructed.
+ *
+ * The counting operator new lives in AllocCounter.cpp, so that file must be
+ * linked into any program that uses this class.
+ *
+ * @code
+ * AllocCounter counter;
+ * manager.run();
+ * cout << counter.get_allocations() << " allocations\n";
+ * @endcode
+ */
+class AllocCounter {
+    size_t start; ///< Process-wide total when this counter was created
+
+public:
+    /** @brief Start counting from the current total. */
+    AllocCounter() : start(get_total()) {}
+
+    /** @brief Restart counting from the current total. */
+    void reset() { start = get_total(); }
+
+    /** @brief Allocations made since construction or the last reset(). */
+    size_t get_allocations() const { return get_total() - start; }
+
+    /** @brief Allocations made by the whole process so far. */
+    static size_t get_total();
+};
+
+#endif // ALLOC_COUNTER_H
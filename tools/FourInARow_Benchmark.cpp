@@ -0,0 +1,228 @@
+// FourInARow_Benchmark.cpp
+// Fixed-suite speed and accuracy benchmark for the Four-in-a-Row engine
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -pthread -I. -IGames tools/FourInARow_Benchmark.cpp -o c4bench
+// Run:
+//   ./c4bench                      AI player, depth 16, one thread, no book
+//   ./c4bench --engine solver      exact solver on every position (Fhourstones style;
+//                                  the openings take a few minutes)
+//   ./c4bench --category endgame --threads 4 --time 500
+//
+// One line per position, then a single line starting with "SUMMARY " and
+// holding a JSON object with the totals, overall and per category, for
+// scripts that track speed and accuracy across releases. The exit status
+// is 1 if any position was answered wrongly.
+
+#include "FourInARow_AI_Player.h"
+#include "FourInARow_Solver.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+/**
+ * @brief One suite position and its known value
+ *
+ * moves lists the columns played from the empty board, 1 to 7 (the usual
+ * Connect Four notation). score is the exact solver score for the side to
+ * move: positive wins, 0 draws, negative loses, larger magnitudes sooner.
+ * columns marks each column '+' if playing it keeps that result, '-' if
+ * it gives some of it away, '.' if the column is full.
+ *
+ * Values were computed with FourInARow_Solver and no node budget;
+ * "--engine solver" recomputes and checks them.
+ */
+struct BenchPosition {
+    const char* category;
+    const char* moves;
+    int score;
+    const char* columns;
+};
+
+static const BenchPosition SUITE[] = {
+    // Openings: 7 to 9 stones, where the solver needs seconds to a minute
+    { "opening", "71363124", 3, "--+----" },
+    { "opening", "66235551", 2, "--+----" },
+    { "opening", "467353753", 12, "-++++++" },
+    { "opening", "67547766", 2, "----+--" },
+    { "opening", "24113231", 3, "--+----" },
+    { "opening", "7723645", 5, "---+-+-" },
+    { "opening", "53436537", 0, "---+---" },
+    { "opening", "162676651", 11, "--+++--" },
+
+    // Middlegames: 12 to 18 stones
+    { "middlegame", "1676474471146", 3, "---+-+-" },
+    { "middlegame", "2254255673221", 4, "---+---" },
+    { "middlegame", "435751131472", 4, "+--++--" },
+    { "middlegame", "627111356327144745", 11, "---++++" },
+    { "middlegame", "245533471751122", 0, "--+---+" },
+    { "middlegame", "417442566667567", 0, "---++--" },
+    { "middlegame", "47617335772466166", 4, "+-++-++" },
+    { "middlegame", "42135412675322", 12, "+--++--" },
+    { "middlegame", "5432411242142", 14, "+------" },
+    { "middlegame", "2524625725155", 6, "++-++++" },
+
+    // Deep endgames: 22 to 30 stones
+    { "endgame", "2341525635341532172332116", 4, "++.-+++" },
+    { "endgame", "6163547721234755337315", 9, "-+-+++-" },
+    { "endgame", "57631625525543452166747", 9, "--+-.--" },
+    { "endgame", "237145772715345773455222", 0, "---+--." },
+    { "endgame", "46766442661177241142233463711", 0, ".++.-.-" },
+    { "endgame", "171134777311445561345574264", 5, ".-+.---" },
+    { "endgame", "7433446664412463362331", 2, "++..---" },
+    { "endgame", "654656176444441671552161221523", 0, ".+-.+.-" },
+    { "endgame", "2412113531535224136225574656", 0, "-.-+.+-" },
+    { "endgame", "7465561566353776361427732", 8, "++--+.+" },
+};
+
+static const char* CATEGORIES[] = { "opening", "middlegame", "endgame" };
+static const int CATEGORY_COUNT = 3;
+
+/**
+ * @brief Settings read from the command line
+ */
+struct BenchOptions {
+    string engine = "ai";    ///< "ai" (FourInARow_AI_Player) or "solver" (FourInARow_Solver)
+    string category = "all"; ///< Run only this category
+    int depth = 16;          ///< AI iteration depth (0 = only the clock limits)
+    int time_ms = 0;         ///< AI time per position (0 = unlimited, depth decides)
+    int threads = 1;         ///< AI search threads
+    bool book = false;       ///< Let the AI answer from the opening book
+};
+
+/**
+ * @brief Totals for a group of positions
+ */
+struct BenchTotals {
+    int positions = 0;
+    int correct = 0;
+    unsigned long long nodes = 0;
+    double seconds = 0;
+
+    void add(bool ok, unsigned long long n, double s) {
+        positions++;
+        correct += ok;
+        nodes += n;
+        seconds += s;
+    }
+
+    double nodes_per_second() const { return seconds > 0 ? nodes / seconds : 0; }
+
+    /** @brief The totals as a JSON object. */
+    string json() const {
+        char buf[256];
+        snprintf(buf, sizeof buf,
+                 "{\"positions\":%d,\"correct\":%d,\"nodes\":%llu,\"seconds\":%.6f,\"nodes_per_second\":%.0f}",
+                 positions, correct, nodes, seconds, nodes_per_second());
+        return buf;
+    }
+};
+
+static bool parse_args(int argc, char** argv, BenchOptions& opt) {
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) return false;
+        if (strcmp(argv[i], "--engine") == 0) opt.engine = argv[++i];
+        else if (strcmp(argv[i], "--category") == 0) opt.category = argv[++i];
+        else if (strcmp(argv[i], "--depth") == 0) opt.depth = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--time") == 0) opt.time_ms = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0) opt.threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--book") == 0) opt.book = atoi(argv[++i]) != 0;
+        else return false;
+    }
+    return (opt.engine == "ai" || opt.engine == "solver") && opt.threads > 0 &&
+           (opt.depth > 0 || opt.time_ms > 0);
+}
+
+/**
+ * @brief Play a move string from the empty board
+ * @return false if a move is illegal or ends the game
+ */
+static bool load(const char* moves, FourInARow_Position& pos) {
+    pos = FourInARow_Position();
+    for (const char* m = moves; *m; m++) {
+        int col = *m - '1';
+        if (col < 0 || col >= FourInARow_Position::WIDTH || !pos.can_play(col) || pos.is_winning_move(col))
+            return false;
+        pos.play_column(col);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt;
+    if (!parse_args(argc, argv, opt)) {
+        cerr << "Usage: " << argv[0]
+             << " [--engine ai|solver] [--category opening|middlegame|endgame|all]"
+                " [--depth D] [--time MS] [--threads N] [--book 0|1]\n";
+        return 1;
+    }
+
+    FourInARow_AI_Player ai("Bench", 'X');
+    ai.set_use_book(opt.book);
+    ai.set_threads(opt.threads);
+    ai.set_depth_limit(opt.depth);
+    ai.set_time_budget(opt.time_ms > 0 ? opt.time_ms : 1000000000);
+    FourInARow_Solver solver;
+
+    BenchTotals total, per_category[CATEGORY_COUNT];
+    printf("%-10s %-32s %6s %7s %8s %14s %10s %10s\n",
+           "category", "moves", "score", "answer", "result", "nodes", "ms", "knodes/s");
+
+    for (const BenchPosition& bp : SUITE) {
+        if (opt.category != "all" && opt.category != bp.category) continue;
+        FourInARow_Position pos;
+        if (!load(bp.moves, pos)) {
+            cerr << "Bad suite position " << bp.moves << "\n";
+            return 1;
+        }
+
+        bool ok;
+        int answer = 0;
+        unsigned long long nodes;
+        auto start = chrono::steady_clock::now();
+        if (opt.engine == "ai") {
+            ai.new_game(); // Each position is timed from a cold start, whatever ran before
+            answer = ai.get_best_column(pos);
+            nodes = ai.get_nodes();
+            ok = bp.columns[answer] == '+';
+        } else {
+            solver.solve(pos, answer);
+            nodes = solver.get_nodes();
+            ok = answer == bp.score;
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        total.add(ok, nodes, seconds);
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+            if (strcmp(bp.category, CATEGORIES[c]) == 0) per_category[c].add(ok, nodes, seconds);
+
+        // The AI answers with a column, shown 1-based like the move strings
+        printf("%-10s %-32s %6d %7d %8s %14llu %10.1f %10.0f\n",
+               bp.category, bp.moves, bp.score, opt.engine == "ai" ? answer + 1 : answer,
+               ok ? "ok" : "WRONG", nodes, seconds * 1000,
+               seconds > 0 ? nodes / seconds / 1000 : 0.0);
+        fflush(stdout);
+    }
+
+    printf("\n%d/%d correct, %llu nodes in %.3f s (%.0f knodes/s)\n", total.correct, total.positions,
+           total.nodes, total.seconds, total.nodes_per_second() / 1000);
+
+    string summary = "{\"engine\":\"" + opt.engine + "\",\"depth\":" + to_string(opt.depth) +
+                     ",\"time_ms\":" + to_string(opt.time_ms) + ",\"threads\":" + to_string(opt.threads) +
+                     ",\"book\":" + (opt.book ? "true" : "false") + ",\"total\":" + total.json() +
+                     ",\"categories\":{";
+    bool first = true;
+    for (int c = 0; c < CATEGORY_COUNT; c++) {
+        if (per_category[c].positions == 0) continue;
+        summary += string(first ? "" : ",") + "\"" + CATEGORIES[c] + "\":" + per_category[c].json();
+        first = false;
+    }
+    summary += "}}";
+    printf("SUMMARY %s\n", summary.c_str());
+    return total.correct == total.positions ? 0 : 1;
+}
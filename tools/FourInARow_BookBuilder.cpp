@@ -0,0 +1,116 @@
+// FourInARow_BookBuilder.cpp
+// Offline builder for the Four-in-a-Row opening book (c4book.bin)
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -pthread -I. -IGames tools/FourInARow_BookBuilder.cpp -o c4book_builder
+// Run:
+//   ./c4book_builder --ply 6 --depth 20 --solve-nodes 2000000 --out c4book.bin
+//
+// Book moves are played instead of searching, so the fallback depth must
+// stay well past what the live AI reaches in its time budget (14 to 16).
+
+#include "FourInARow_AI_Player.h"
+#include "FourInARow_Book.h"
+#include "FourInARow_Solver.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Settings read from the command line
+ */
+struct BuildOptions {
+    int ply = 6;                              ///< Book every position with fewer stones than this
+    int depth = 20;                           ///< Search depth when the solver gives up
+    unsigned long long solve_nodes = 2000000; ///< Solver node budget per position
+    string out = "c4book.bin";                ///< Output file
+};
+
+/**
+ * @brief Collect every reachable position with fewer than max_ply stones.
+ *
+ * Positions that are already won (or lost at once) are skipped: the AI
+ * answers those without the book. Mirror images are visited only once.
+ */
+static void enumerate(const FourInARow_Position& pos, int max_ply,
+                      unordered_set<uint64_t>& seen, vector<FourInARow_Position>& out) {
+    if (pos.nb_moves() >= max_ply || pos.can_win_next()) return;
+    bool mirrored;
+    if (!seen.insert(pos.canonical_key(mirrored)).second) return;
+    out.push_back(pos);
+
+    for (int col = 0; col < FourInARow_Position::WIDTH; col++) {
+        if (!pos.can_play(col)) continue;
+        FourInARow_Position child = pos;
+        child.play_column(col);
+        enumerate(child, max_ply, seen, out);
+    }
+}
+
+static bool parse_args(int argc, char** argv, BuildOptions& opt) {
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) return false;
+        if (strcmp(argv[i], "--ply") == 0) opt.ply = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--depth") == 0) opt.depth = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--solve-nodes") == 0) opt.solve_nodes = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--out") == 0) opt.out = argv[++i];
+        else return false;
+    }
+    return opt.ply > 0 && opt.depth > 0;
+}
+
+int main(int argc, char** argv) {
+    BuildOptions opt;
+    if (!parse_args(argc, argv, opt)) {
+        cerr << "Usage: " << argv[0]
+             << " [--ply N] [--depth D] [--solve-nodes K] [--out FILE]\n";
+        return 1;
+    }
+
+    unordered_set<uint64_t> seen;
+    vector<FourInARow_Position> positions;
+    enumerate(FourInARow_Position(), opt.ply, seen, positions);
+    cout << positions.size() << " positions below ply " << opt.ply << "\n";
+
+    // Heuristic fallback: fixed depth, one thread, never reading the book being built
+    FourInARow_AI_Player searcher("Book", 'X');
+    searcher.set_use_book(false);
+    searcher.set_threads(1);
+    searcher.set_depth_limit(opt.depth);
+    searcher.set_time_budget(1000000000);
+
+    FourInARow_Solver solver(opt.solve_nodes);
+    vector<uint64_t> entries;
+    int solved = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (const FourInARow_Position& pos : positions) {
+        int col, score;
+        if (solver.best_column(pos, col, score)) {
+            solved++;
+        } else {
+            col = searcher.get_best_column(pos);
+            score = FourInARow_Book::UNKNOWN_SCORE;
+        }
+        entries.push_back(FourInARow_Book::make_entry(pos, col, score));
+
+        if (entries.size() % 100 == 0)
+            cout << "  " << entries.size() << " / " << positions.size() << "\n";
+    }
+
+    if (!FourInARow_Book::write(opt.out, entries)) {
+        cerr << "Could not write " << opt.out << "\n";
+        return 1;
+    }
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "Wrote " << entries.size() << " entries (" << solved << " solved exactly) to "
+         << opt.out << " in " << seconds << " s\n";
+    return 0;
+}
@@ -0,0 +1,158 @@
+// FourInARow_SelfPlay.cpp
+// Self-play training data export for the Four-in-a-Row evaluator
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -pthread -I. -IGames tools/FourInARow_SelfPlay.cpp -o c4selfplay
+// Run:
+//   ./c4selfplay --games 10000 --depth 6 --out c4selfplay.txt
+//
+// Each line of the output is one position:
+//   <side to move stones> <all stones> <result> <exact>
+// Stones are FourInARow_Position bitboards in hex. result is 1, 0 or -1
+// for a win, draw or loss of the side to move: the solver's verdict when
+// exact is 1, otherwise how the self-play game ended.
+
+#include "FourInARow_AI_Player.h"
+#include "FourInARow_Solver.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Settings read from the command line
+ */
+struct SelfPlayOptions {
+    int games = 1000;                        ///< Games to play
+    int depth = 6;                           ///< Search depth of both players
+    int random_plies = 2;                    ///< Uniformly random opening moves per game
+    double epsilon = 0.1;                    ///< Chance of a random move after the opening
+    int solve_from = 14;                     ///< Stones on the board before trying the solver
+    unsigned long long solve_nodes = 200000; ///< Solver node budget per position
+    unsigned seed = 1;                       ///< Random seed
+    string out = "c4selfplay.txt";           ///< Output file
+};
+
+/**
+ * @brief One recorded position and its label
+ */
+struct Sample {
+    FourInARow_Position pos;
+    int result = 0;     ///< For the side to move
+    bool exact = false; ///< result comes from the solver
+};
+
+static bool parse_args(int argc, char** argv, SelfPlayOptions& opt) {
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) return false;
+        if (strcmp(argv[i], "--games") == 0) opt.games = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--depth") == 0) opt.depth = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--random-plies") == 0) opt.random_plies = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--epsilon") == 0) opt.epsilon = atof(argv[++i]);
+        else if (strcmp(argv[i], "--solve-from") == 0) opt.solve_from = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--solve-nodes") == 0) opt.solve_nodes = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--seed") == 0) opt.seed = (unsigned)strtoul(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--out") == 0) opt.out = argv[++i];
+        else return false;
+    }
+    return opt.games > 0 && opt.depth > 0;
+}
+
+/**
+ * @brief Pick a uniformly random open column
+ */
+static int random_column(const FourInARow_Position& pos, mt19937& rng) {
+    int open[FourInARow_Position::WIDTH];
+    int count = 0;
+    for (int col = 0; col < FourInARow_Position::WIDTH; col++)
+        if (pos.can_play(col)) open[count++] = col;
+    return open[rng() % count];
+}
+
+int main(int argc, char** argv) {
+    SelfPlayOptions opt;
+    if (!parse_args(argc, argv, opt)) {
+        cerr << "Usage: " << argv[0]
+             << " [--games N] [--depth D] [--random-plies R] [--epsilon E]"
+                " [--solve-from S] [--solve-nodes K] [--seed S] [--out FILE]\n";
+        return 1;
+    }
+
+    FILE* out = fopen(opt.out.c_str(), "w");
+    if (!out) {
+        cerr << "Could not write " << opt.out << "\n";
+        return 1;
+    }
+
+    // One player per parity, so each keeps a consistent point of view in its table
+    FourInARow_AI_Player* players[2] = {
+        new FourInARow_AI_Player("First", 'X'),
+        new FourInARow_AI_Player("Second", 'O')
+    };
+    for (FourInARow_AI_Player* p : players) {
+        p->set_use_book(false);
+        p->set_threads(1);
+        p->set_depth_limit(opt.depth);
+        p->set_time_budget(1000000000);
+    }
+
+    mt19937 rng(opt.seed);
+    uniform_real_distribution<double> coin(0.0, 1.0);
+    FourInARow_Solver solver(opt.solve_nodes);
+    long long written = 0, solved = 0;
+    const int cells = FourInARow_Position::WIDTH * FourInARow_Position::HEIGHT;
+
+    for (int game = 0; game < opt.games; game++) {
+        FourInARow_Position pos;
+        vector<Sample> samples;
+        int winner = -1; // Parity of the winner, -1 for a draw
+
+        while (pos.nb_moves() < cells) {
+            int col;
+            if (pos.can_win_next()) {
+                for (col = 0; !pos.is_winning_move(col); col++) {}
+                winner = pos.nb_moves() % 2;
+                break;
+            }
+
+            Sample s;
+            s.pos = pos;
+            if (pos.nb_moves() >= opt.solve_from) {
+                int score;
+                if (solver.solve(pos, score)) {
+                    s.result = score > 0 ? 1 : score < 0 ? -1 : 0;
+                    s.exact = true;
+                }
+            }
+            samples.push_back(s);
+
+            if (pos.nb_moves() < opt.random_plies || coin(rng) < opt.epsilon)
+                col = random_column(pos, rng);
+            else
+                col = players[pos.nb_moves() % 2]->get_best_column(pos);
+            pos.play_column(col);
+        }
+
+        for (Sample& s : samples) {
+            if (!s.exact)
+                s.result = winner < 0 ? 0 : winner == s.pos.nb_moves() % 2 ? 1 : -1;
+            fprintf(out, "%llx %llx %d %d\n", (unsigned long long)s.pos.get_current(),
+                    (unsigned long long)s.pos.get_mask(), s.result, s.exact ? 1 : 0);
+            written++;
+            solved += s.exact;
+        }
+
+        if ((game + 1) % 100 == 0)
+            cout << "  " << game + 1 << " / " << opt.games << " games, " << written << " positions\n";
+    }
+
+    fclose(out);
+    for (FourInARow_AI_Player* p : players) delete p;
+    cout << "Wrote " << written << " positions (" << solved << " solved exactly) to " << opt.out << "\n";
+    return 0;
+}
@@ -0,0 +1,350 @@
+// FourInARow_Trainer.cpp
+// CPU trainer for the Four-in-a-Row evaluation network (FourInARow_NNUE.h)
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -I. -IGames tools/FourInARow_Trainer.cpp -o c4trainer
+// Run on files written by tools/FourInARow_SelfPlay.cpp:
+//   ./c4trainer --hidden 64 --epochs 30 --out Games/FourInARow_NNUE_Weights.h c4selfplay.txt
+//
+// Trains in floating point, then quantizes to the integer layout that
+// FourInARow_NNUE reads and writes it out as a C++ header.
+
+#include "FourInARow_Solver.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+static const int CELLS = FourInARow_Position::WIDTH * FourInARow_Position::HEIGHT;
+static const int INPUTS = 2 * CELLS;
+static const int ACTIVATION_MAX = 127;     // Must match FourInARow_NNUE
+static const int OUTPUT_WEIGHT_SCALE = 64; // Must match FourInARow_NNUE
+
+/**
+ * @brief Settings read from the command line
+ */
+struct TrainOptions {
+    int hidden = 64;                                   ///< Accumulator width per side
+    int epochs = 30;                                   ///< Passes over the training set
+    int batch = 256;                                   ///< Positions per optimizer step
+    double lr = 0.002;                                 ///< Adam step size
+    double val_fraction = 0.05;                        ///< Positions held out for validation
+    unsigned seed = 1;                                 ///< Random seed
+    string out = "Games/FourInARow_NNUE_Weights.h";    ///< Generated header
+    vector<string> inputs;                             ///< Self-play files
+};
+
+/**
+ * @brief One distinct position with its averaged label
+ */
+struct Example {
+    uint64_t own = 0;   ///< Stones of the side to move
+    uint64_t other = 0; ///< Stones of the other side
+    float target = 0;   ///< Win probability for the side to move
+    bool exact = false; ///< Label came from the solver
+};
+
+/**
+ * @brief Floating-point copy of the network and its Adam state
+ */
+struct Network {
+    int hidden;
+    vector<float> w, b, v; ///< Feature weights [INPUTS][hidden], biases, output weights [2 * hidden]
+    float c = 0;           ///< Output bias
+
+    explicit Network(int h) : hidden(h), w(INPUTS * h), b(h), v(2 * h) {}
+};
+
+static bool parse_args(int argc, char** argv, TrainOptions& opt) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--hidden") == 0 && has_value) opt.hidden = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--epochs") == 0 && has_value) opt.epochs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--batch") == 0 && has_value) opt.batch = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--lr") == 0 && has_value) opt.lr = atof(argv[++i]);
+        else if (strcmp(argv[i], "--val") == 0 && has_value) opt.val_fraction = atof(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && has_value) opt.seed = (unsigned)strtoul(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--out") == 0 && has_value) opt.out = argv[++i];
+        else if (argv[i][0] == '-') return false;
+        else opt.inputs.push_back(argv[i]);
+    }
+    return !opt.inputs.empty() && opt.hidden > 0 && opt.hidden % 32 == 0 && opt.epochs > 0;
+}
+
+/**
+ * @brief Read self-play files, merging repeats and mirror images of a position
+ *
+ * Labels of a repeated position are averaged; a solver verdict, when there
+ * is one, replaces the game results. Training flips positions at random,
+ * so mirror images never land on both sides of the validation split.
+ */
+static bool load(const vector<string>& paths, vector<Example>& examples) {
+    struct Tally { uint64_t own, other; double sum = 0; int count = 0; bool exact = false; };
+    unordered_map<uint64_t, Tally> seen;
+
+    for (const string& path : paths) {
+        FILE* in = fopen(path.c_str(), "r");
+        if (!in) {
+            cerr << "Could not read " << path << "\n";
+            return false;
+        }
+        unsigned long long current, mask;
+        int result, exact;
+        while (fscanf(in, "%llx %llx %d %d", &current, &mask, &result, &exact) == 4) {
+            uint64_t key = current + mask;
+            uint64_t flipped = FourInARow_Position::mirror(key);
+            if (flipped < key) {
+                current = FourInARow_Position::mirror(current);
+                mask = FourInARow_Position::mirror(mask);
+            }
+            Tally& t = seen[min(key, flipped)];
+            t.own = current;
+            t.other = current ^ mask;
+            if (exact && !t.exact) { t.sum = 0; t.count = 0; t.exact = true; }
+            if (exact || !t.exact) { t.sum += (result + 1) / 2.0; t.count++; }
+        }
+        fclose(in);
+    }
+
+    for (auto& entry : seen) {
+        const Tally& t = entry.second;
+        examples.push_back({ t.own, t.other, float(t.sum / t.count), t.exact });
+    }
+    sort(examples.begin(), examples.end(), [](const Example& a, const Example& b) {
+        return a.own + (a.own | a.other) < b.own + (b.own | b.other);
+    });
+    return true;
+}
+
+/** @brief Network input of a cell bit index (col * 7 + h -> col * 6 + h). */
+static int cell_index(int bit) {
+    return bit - bit / (FourInARow_Position::HEIGHT + 1);
+}
+
+/** @brief Input indices that are on for a point of view owning mine. */
+static int features(uint64_t mine, uint64_t theirs, int out[]) {
+    int n = 0;
+    for (; mine; mine &= mine - 1) out[n++] = cell_index(__builtin_ctzll(mine));
+    for (; theirs; theirs &= theirs - 1) out[n++] = CELLS + cell_index(__builtin_ctzll(theirs));
+    return n;
+}
+
+/**
+ * @brief Forward pass; fills the pre-activations for the backward pass
+ * @return Output logit for the side to move
+ */
+static float forward(const Network& net, const Example& e, vector<float>& pre,
+                     int f[2][CELLS], int n[2]) {
+    int h = net.hidden;
+    n[0] = features(e.own, e.other, f[0]);
+    n[1] = features(e.other, e.own, f[1]);
+    float out = net.c;
+    for (int side = 0; side < 2; side++) {
+        float* a = &pre[side * h];
+        for (int j = 0; j < h; j++) a[j] = net.b[j];
+        for (int k = 0; k < n[side]; k++) {
+            const float* row = &net.w[f[side][k] * h];
+            for (int j = 0; j < h; j++) a[j] += row[j];
+        }
+        for (int j = 0; j < h; j++)
+            out += net.v[side * h + j] * min(max(a[j], 0.0f), 1.0f);
+    }
+    return out;
+}
+
+/**
+ * @brief Output logit the quantized network computes (same math as FourInARow_NNUE)
+ */
+static float quantized_forward(const vector<int16_t>& qw, const vector<int16_t>& qb,
+                               const vector<int8_t>& qv, int32_t qc, int h, const Example& e) {
+    int f[2][CELLS], n[2];
+    n[0] = features(e.own, e.other, f[0]);
+    n[1] = features(e.other, e.own, f[1]);
+    int32_t sum = qc;
+    for (int side = 0; side < 2; side++) {
+        for (int j = 0; j < h; j++) {
+            int16_t a = qb[j];
+            for (int k = 0; k < n[side]; k++) a += qw[f[side][k] * h + j];
+            int act = a < 0 ? 0 : a > ACTIVATION_MAX ? ACTIVATION_MAX : a;
+            sum += act * qv[side * h + j];
+        }
+    }
+    return sum / float(ACTIVATION_MAX * OUTPUT_WEIGHT_SCALE);
+}
+
+static float sigmoid(float x) { return 1.0f / (1.0f + exp(-x)); }
+
+/**
+ * @brief Mean log loss and decisive-exact accuracy of a logit function over examples
+ */
+template <typename F>
+static void measure(const vector<Example>& set, F logit, double& loss, double& accuracy) {
+    loss = 0;
+    int decisive = 0, correct = 0;
+    for (const Example& e : set) {
+        float p = min(max(sigmoid(logit(e)), 1e-6f), 1.0f - 1e-6f);
+        loss -= e.target * log(p) + (1 - e.target) * log(1 - p);
+        if (e.exact && e.target != 0.5f) {
+            decisive++;
+            correct += (p > 0.5f) == (e.target > 0.5f);
+        }
+    }
+    loss /= max<size_t>(set.size(), 1);
+    accuracy = decisive ? double(correct) / decisive : 0;
+}
+
+/**
+ * @brief One Adam update of a parameter block
+ */
+static void adam(vector<float>& p, vector<float>& g, vector<float>& m, vector<float>& s,
+                 double lr, int step, float limit) {
+    const double b1 = 0.9, b2 = 0.999, eps = 1e-8;
+    double c1 = 1 - pow(b1, step), c2 = 1 - pow(b2, step);
+    for (size_t i = 0; i < p.size(); i++) {
+        m[i] = float(b1 * m[i] + (1 - b1) * g[i]);
+        s[i] = float(b2 * s[i] + (1 - b2) * g[i] * g[i]);
+        p[i] -= float(lr * (m[i] / c1) / (sqrt(s[i] / c2) + eps));
+        p[i] = min(max(p[i], -limit), limit);
+        g[i] = 0;
+    }
+}
+
+static bool write_header(const string& path, int h, const vector<int16_t>& qw, const vector<int16_t>& qb,
+                         const vector<int8_t>& qv, int32_t qc, size_t examples, double loss) {
+    FILE* out = fopen(path.c_str(), "w");
+    if (!out) return false;
+    fprintf(out, "// FourInARow_NNUE_Weights.h\n");
+    fprintf(out, "// Generated by tools/FourInARow_Trainer.cpp from %zu self-play positions\n", examples);
+    fprintf(out, "// (validation log loss %.4f). Regenerate rather than edit.\n\n", loss);
+    fprintf(out, "#ifndef FOUR_IN_A_ROW_NNUE_WEIGHTS_H\n#define FOUR_IN_A_ROW_NNUE_WEIGHTS_H\n\n");
+    fprintf(out, "#include <cstdint>\n\n");
+    fprintf(out, "/**\n * @brief Quantized weights of FourInARow_NNUE\n */\n");
+    fprintf(out, "struct FourInARow_NNUE_Weights {\n");
+    fprintf(out, "    static const int HIDDEN = %d;\n\n", h);
+
+    fprintf(out, "    alignas(32) static constexpr int16_t feature_weights[%d][HIDDEN] = {\n", INPUTS);
+    for (int i = 0; i < INPUTS; i++) {
+        fprintf(out, "        {");
+        for (int j = 0; j < h; j++) fprintf(out, "%s%d", j ? "," : "", qw[i * h + j]);
+        fprintf(out, "},\n");
+    }
+    fprintf(out, "    };\n\n");
+
+    fprintf(out, "    alignas(32) static constexpr int16_t feature_bias[HIDDEN] = {");
+    for (int j = 0; j < h; j++) fprintf(out, "%s%d", j ? "," : "", qb[j]);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "    alignas(32) static constexpr int8_t output_weights[2 * HIDDEN] = {");
+    for (int j = 0; j < 2 * h; j++) fprintf(out, "%s%d", j ? "," : "", qv[j]);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "    static constexpr int32_t output_bias = %d;\n", qc);
+    fprintf(out, "};\n\n#endif // FOUR_IN_A_ROW_NNUE_WEIGHTS_H\n");
+    return fclose(out) == 0;
+}
+
+int main(int argc, char** argv) {
+    TrainOptions opt;
+    if (!parse_args(argc, argv, opt)) {
+        cerr << "Usage: " << argv[0]
+             << " [--hidden H] [--epochs N] [--batch B] [--lr R] [--val F] [--seed S] [--out FILE] data..."
+                "\n(H must be a multiple of 32)\n";
+        return 1;
+    }
+
+    vector<Example> all;
+    if (!load(opt.inputs, all)) return 1;
+    mt19937 rng(opt.seed);
+    shuffle(all.begin(), all.end(), rng);
+    size_t val_count = size_t(all.size() * opt.val_fraction);
+    vector<Example> val(all.begin(), all.begin() + val_count);
+    vector<Example> train(all.begin() + val_count, all.end());
+    cout << train.size() << " training and " << val.size() << " validation positions\n";
+
+    // The largest first-layer sum (42 rows plus the bias) must fit in int16
+    const int h = opt.hidden;
+    const float weight_limit = 32767.0f / ACTIVATION_MAX / (CELLS + 1);
+    const float output_limit = 127.0f / OUTPUT_WEIGHT_SCALE;
+
+    Network net(h);
+    normal_distribution<float> init(0.0f, 0.1f);
+    uniform_real_distribution<float> bias_init(0.0f, 0.5f);
+    for (float& x : net.w) x = init(rng);
+    for (float& x : net.b) x = bias_init(rng);
+    for (float& x : net.v) x = init(rng);
+
+    vector<float> gw(net.w.size()), gb(h), gv(2 * h), gc(1);
+    vector<float> mw(net.w.size()), sw(net.w.size()), mb(h), sb(h), mv(2 * h), sv(2 * h), mc(1), sc(1);
+    vector<float> pre(2 * h);
+    int f[2][CELLS], n[2];
+    int step = 0;
+
+    for (int epoch = 1; epoch <= opt.epochs; epoch++) {
+        shuffle(train.begin(), train.end(), rng);
+        double lr = opt.lr * (epoch > opt.epochs * 3 / 4 ? 0.1 : 1.0);
+
+        for (size_t start = 0; start < train.size(); start += opt.batch) {
+            size_t end = min(train.size(), start + opt.batch);
+            float scale = 1.0f / (end - start);
+            for (size_t i = start; i < end; i++) {
+                Example e = train[i];
+                if (rng() & 1) {
+                    e.own = FourInARow_Position::mirror(e.own);
+                    e.other = FourInARow_Position::mirror(e.other);
+                }
+                float g = (sigmoid(forward(net, e, pre, f, n)) - e.target) * scale;
+                gc[0] += g;
+                for (int side = 0; side < 2; side++) {
+                    for (int j = 0; j < h; j++) {
+                        float a = pre[side * h + j];
+                        gv[side * h + j] += g * min(max(a, 0.0f), 1.0f);
+                        if (a <= 0.0f || a >= 1.0f) continue;
+                        float ga = g * net.v[side * h + j];
+                        gb[j] += ga;
+                        for (int k = 0; k < n[side]; k++) gw[f[side][k] * h + j] += ga;
+                    }
+                }
+            }
+            step++;
+            adam(net.w, gw, mw, sw, lr, step, weight_limit);
+            adam(net.b, gb, mb, sb, lr, step, weight_limit);
+            adam(net.v, gv, mv, sv, lr, step, output_limit);
+            vector<float> c = { net.c };
+            adam(c, gc, mc, sc, lr, step, 1e6f);
+            net.c = c[0];
+        }
+
+        double loss, accuracy;
+        measure(val, [&](const Example& e) { return forward(net, e, pre, f, n); }, loss, accuracy);
+        printf("epoch %2d  val loss %.4f  solved-position accuracy %.3f\n", epoch, loss, accuracy);
+        fflush(stdout);
+    }
+
+    // Quantize: activations 0..1 -> 0..ACTIVATION_MAX, output weights x OUTPUT_WEIGHT_SCALE
+    vector<int16_t> qw(net.w.size()), qb(h);
+    vector<int8_t> qv(2 * h);
+    for (size_t i = 0; i < net.w.size(); i++) qw[i] = int16_t(lround(net.w[i] * ACTIVATION_MAX));
+    for (int j = 0; j < h; j++) qb[j] = int16_t(lround(net.b[j] * ACTIVATION_MAX));
+    for (int j = 0; j < 2 * h; j++) qv[j] = int8_t(lround(net.v[j] * OUTPUT_WEIGHT_SCALE));
+    int32_t qc = int32_t(lround(net.c * ACTIVATION_MAX * OUTPUT_WEIGHT_SCALE));
+
+    double loss, accuracy;
+    measure(val, [&](const Example& e) { return quantized_forward(qw, qb, qv, qc, h, e); }, loss, accuracy);
+    printf("quantized  val loss %.4f  solved-position accuracy %.3f\n", loss, accuracy);
+
+    if (!write_header(opt.out, h, qw, qb, qv, qc, all.size(), loss)) {
+        cerr << "Could not write " << opt.out << "\n";
+        return 1;
+    }
+    cout << "Wrote " << opt.out << "\n";
+    return 0;
+}
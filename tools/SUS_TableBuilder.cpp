@@ -0,0 +1,62 @@
+// SUS_TableBuilder.cpp
+// Solves 3x3 SUS exactly and writes the perfect-play table (SUS_Table.h)
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -I. -IGames tools/SUS_TableBuilder.cpp -o sus_table_builder
+// Run:
+//   ./sus_table_builder --out Games/SUS_Table.h
+
+#include "SUS_Solver.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const int PER_LINE = 27; ///< Values per line of the generated array
+
+static bool write_header(const string& path, const vector<int8_t>& values) {
+    FILE* out = fopen(path.c_str(), "w");
+    if (!out) return false;
+
+    fprintf(out, "// SUS_Table.h\n");
+    fprintf(out, "// Generated by tools/SUS_TableBuilder.cpp: exact values of every 3x3 SUS\n");
+    fprintf(out, "// position (empty board: %d). Regenerate rather than edit.\n\n", values[0]);
+    fprintf(out, "#ifndef SUS_TABLE_H\n#define SUS_TABLE_H\n\n");
+    fprintf(out, "#include <cstdint>\n\n");
+    fprintf(out, "/**\n * @brief Perfect-play values of SUS positions, indexed as in SUS_Solver\n");
+    fprintf(out, " *\n * Best score difference still to be made by the side to move;\n");
+    fprintf(out, " * positions that can't be reached hold 0.\n */\n");
+    fprintf(out, "struct SUS_Table {\n");
+    fprintf(out, "    static constexpr int8_t values[%zu] = {\n", values.size());
+    for (size_t i = 0; i < values.size(); i += PER_LINE) {
+        fprintf(out, "        ");
+        for (size_t j = i; j < i + PER_LINE && j < values.size(); j++)
+            fprintf(out, "%d,", values[j]);
+        fprintf(out, "\n");
+    }
+    fprintf(out, "    };\n};\n\n#endif // SUS_TABLE_H\n");
+    return fclose(out) == 0;
+}
+
+int main(int argc, char** argv) {
+    string out = "SUS_Table.h";
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out = argv[++i];
+        } else {
+            cerr << "Usage: " << argv[0] << " [--out FILE]\n";
+            return 1;
+        }
+    }
+
+    vector<int8_t> values = SUS_Solver::solve_all();
+    if (!write_header(out, values)) {
+        cerr << "Could not write " << out << "\n";
+        return 1;
+    }
+    cout << "Empty board value " << int(values[0]) << "; wrote " << out << "\n";
+    return 0;
+}